@@ -0,0 +1,293 @@
+// Code size benchmark for named parameter call patterns.
+//
+// For each pattern this generates a translation unit exercising parameter_binder, bind_parameters and get<value_name> in one
+// particular way, compiles it with optimization and measures the resulting object file with nm: the bytes of code, the number of
+// defined symbols and the total length of their mangled names. Code bytes are what ends up in the instruction cache, while the
+// symbol count and name lengths show how many instantiations survive optimization and how expensive they are for the linker and
+// the debug information. This works with compilers and nm producing ELF or Mach-O objects, i.e. gcc and clang.
+//
+// Usage: bench_code_size <compiler> <source dir> <work dir> [--nm=nm] [--flags=-O2] [--patterns=name,name]
+//                        [--max-text=4096] [--max-names=8192] [--baseline=file] [--tolerance=1.1] [--save=file]
+//
+// The program fails if any pattern has more code bytes than --max-text or longer names in total than --max-names, where 0 turns
+// the limit off. The default limits leave room for growth for gcc and clang with -O2. With --baseline the results are also
+// compared to a file previously written by --save, and the program fails if any pattern got more code bytes, more symbols or
+// longer names than the baseline times the tolerance.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_options.h"
+
+
+struct size_result {
+    size_t text_bytes = 0;
+    size_t symbols = 0;
+    size_t name_bytes = 0;
+};
+
+
+// The names used by all patterns.
+static const int name_count = 8;
+
+static std::string name_declarations()
+{
+    std::ostringstream os;
+    os << "#include \"named.h\"\n#include <string>\n\n";
+    for (int i = 0; i < name_count; i++)
+        os << "std::value_name<\"p" << i << "\"> p" << i << ";\n";
+    return os.str();
+}
+
+// The parameters p0 to p<n - 1>, each given as p<i> = <default>.
+static std::string int_parameters(int n)
+{
+    std::string ret;
+    for (int i = 0; i < n; i++)
+        ret += (i ? ", p" : "p") + std::to_string(i) + " = 0";
+    return ret;
+}
+
+
+// A function with four int parameters called by all 24 orders of its four arguments.
+static std::string pattern_permutations()
+{
+    std::ostringstream os;
+    os << name_declarations();
+    os << "\ntemplate<typename... Ps> int f(Ps&&... ps)\n{\n";
+    os << "    const std::parameter_binder binder(" << int_parameters(4) << ");\n";
+    os << "    auto args = binder.bind(std::forward<Ps>(ps)...);\n";
+    os << "    return std::get<p0>(args) + std::get<p1>(args) * 2 + std::get<p2>(args) * 3 + std::get<p3>(args) * 4;\n}\n\n";
+
+    int order[] = { 0, 1, 2, 3 };
+    int site = 0;
+    do {
+        os << "int site" << site++ << "(int v) { return f(";
+        for (int i = 0; i < 4; i++)
+            os << (i ? ", p" : "p") << order[i] << " = v + " << i;
+        os << "); }\n";
+    } while (std::next_permutation(order, order + 4));
+
+    return os.str();
+}
+
+// A function with eight int parameters called with each subset of its first four parameters.
+static std::string pattern_subsets()
+{
+    std::ostringstream os;
+    os << name_declarations();
+    os << "\ntemplate<typename... Ps> int f(Ps&&... ps)\n{\n";
+    os << "    const std::parameter_binder binder(" << int_parameters(8) << ");\n";
+    os << "    auto args = binder.bind(std::forward<Ps>(ps)...);\n";
+    os << "    return std::get<p0>(args) + std::get<p3>(args) + std::get<p7>(args);\n}\n\n";
+
+    for (int mask = 0; mask < 16; mask++) {
+        os << "int site" << mask << "(int v) { return f(";
+        bool first = true;
+        for (int i = 0; i < 4; i++) {
+            if (mask & (1 << i)) {
+                os << (first ? "p" : ", p") << i << " = v";
+                first = false;
+            }
+        }
+        os << "); }\n";
+    }
+
+    return os.str();
+}
+
+// Parameters of types which are not trivially copyable, with the defaults in a static const binder as recommended.
+static std::string pattern_mixed_types()
+{
+    std::ostringstream os;
+    os << name_declarations();
+    os << "\ntemplate<typename... Ps> size_t f(Ps&&... ps)\n{\n";
+    os << "    static const std::parameter_binder binder(p0 = std::string(\"default\"), p1.optional<int>(), p2.variant<int, std::string>(0), p3 = 1.5);\n";
+    os << "    auto args = binder.bind(std::forward<Ps>(ps)...);\n";
+    os << "    return std::get<p0>(args).size() + size_t(std::get<p1>(args).value_or(0)) + std::get<p2>(args).index() + size_t(std::get<p3>(args));\n}\n\n";
+    os << "size_t site0() { return f(); }\n";
+    os << "size_t site1(const std::string& s) { return f(p0 = s); }\n";
+    os << "size_t site2(int v) { return f(p1 = v, p3 = 2.5); }\n";
+    os << "size_t site3(const std::string& s) { return f(p2 = s, p0 = s); }\n";
+    os << "size_t site4(int v) { return f(p3 = 0.5, p2 = v, p1 = v); }\n";
+    return os.str();
+}
+
+// bind_parameters used directly with the defaults given at each call.
+static std::string pattern_bind_parameters()
+{
+    std::ostringstream os;
+    os << name_declarations();
+    os << "\ntemplate<typename... Ps> int f(Ps&&... ps)\n{\n";
+    os << "    auto args = std::bind_parameters(std::forward_as_tuple(std::forward<Ps>(ps)...), " << int_parameters(name_count) << ");\n";
+    os << "    int sum = 0;\n";
+    for (int i = 0; i < name_count; i++)
+        os << "    sum += std::get<p" << i << ">(args);\n";
+    os << "    return sum;\n}\n\n";
+    for (int i = 0; i < name_count; i++)
+        os << "int site" << i << "(int v) { return f(p" << i << " = v, p" << (name_count - 1 - i) << " = v); }\n";
+    return os.str();
+}
+
+// Lookup by name in tuples of named values, without binding.
+static std::string pattern_get()
+{
+    std::ostringstream os;
+    os << name_declarations();
+    os << "\nusing args = std::tuple<";
+    for (int i = 0; i < name_count; i++)
+        os << (i ? ", " : "") << "std::named_value<decltype(p" << i << ")::name, int>";
+    os << ">;\n\n";
+    for (int i = 0; i < name_count; i++)
+        os << "int site" << i << "(const args& a) { return std::get<p" << i << ">(a) + std::get_or<\"p" << (name_count - 1 - i) << "\">(0, a); }\n";
+    return os.str();
+}
+
+
+struct pattern {
+    const char* name;
+    std::string (*generate)();
+};
+
+static const pattern patterns[] = {
+    { "permutations", pattern_permutations },
+    { "subsets", pattern_subsets },
+    { "mixed_types", pattern_mixed_types },
+    { "bind_parameters", pattern_bind_parameters },
+    { "get", pattern_get },
+};
+
+
+// Measure the defined symbols of an object file from the output of nm -S. Symbols of type t, T, w and W with a size are code.
+static bool measure_object(const std::string& nm, const std::string& object, const std::string& work_dir, size_result& result)
+{
+    std::string listing = work_dir + "/symbols.txt";
+    std::string command = "\"" + nm + "\" -S --defined-only \"" + object + "\" > \"" + listing + "\"";
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "Listing symbols failed: " << command << "\n";
+        return false;
+    }
+
+    std::ifstream is(listing);
+    for (std::string line; std::getline(is, line);) {
+        std::istringstream ls(line);
+        std::vector<std::string> fields;
+        for (std::string field; ls >> field;)
+            fields.push_back(field);
+
+        // Either "address size type name" or, for symbols without size, "address type name".
+        if (fields.size() < 3)
+            continue;
+        const std::string& name = fields.back();
+        const std::string& type = fields[fields.size() - 2];
+        result.symbols++;
+        result.name_bytes += name.size();
+        if (fields.size() == 4 && (type == "t" || type == "T" || type == "w" || type == "W"))
+            result.text_bytes += std::stoul(fields[1], nullptr, 16);
+    }
+
+    return true;
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) {
+        std::cerr << "Usage: bench_code_size <compiler> <source dir> <work dir> [--nm=nm] [--flags=-O2] [--patterns=name,name] [--max-text=4096] [--max-names=8192] [--baseline=file] [--tolerance=1.1] [--save=file]\n";
+        return 2;
+    }
+
+    std::string compiler = argv[1];
+    std::string source_dir = argv[2];
+    std::string work_dir = argv[3];
+    std::string nm = "nm";
+    std::string flags = "-O2";
+    std::vector<std::string> selected;
+    size_t max_text = 4096;
+    size_t max_names = 8192;
+    std::string baseline_file, save_file;
+    double tolerance = 1.1;
+
+    for (int i = 4; i < argc; i++) {
+        std::string arg = argv[i];
+        if (auto v = option_value(arg, "nm"); !v.empty())
+            nm = v;
+        else if (auto v = option_value(arg, "flags"); !v.empty())
+            flags = v;
+        else if (auto v = option_value(arg, "patterns"); !v.empty()) {
+            std::istringstream is(v);
+            for (std::string s; std::getline(is, s, ',');)
+                selected.push_back(s);
+        }
+        else if (auto v = option_value(arg, "max-text"); !v.empty())
+            max_text = std::stoul(v);
+        else if (auto v = option_value(arg, "max-names"); !v.empty())
+            max_names = std::stoul(v);
+        else if (auto v = option_value(arg, "baseline"); !v.empty())
+            baseline_file = v;
+        else if (auto v = option_value(arg, "tolerance"); !v.empty())
+            tolerance = std::stod(v);
+        else if (auto v = option_value(arg, "save"); !v.empty())
+            save_file = v;
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return 2;
+        }
+    }
+
+    std::vector<bench_result> results;
+    bool exceeded = false;
+    std::cout << "pattern            text bytes   symbols   name bytes\n";
+    for (const pattern& p : patterns) {
+        if (!selected.empty() && std::find(selected.begin(), selected.end(), p.name) == selected.end())
+            continue;
+
+        std::string source = work_dir + "/code_size_" + p.name + ".cpp";
+        std::string object = work_dir + "/code_size_" + p.name + ".o";
+        std::ofstream(source) << "// Generated by bench_code_size, pattern " << p.name << ".\n" << p.generate();
+
+        std::string command = "\"" + compiler + "\" -std=c++20 " + flags + " -c -I\"" + source_dir + "\" \"" + source + "\" -o \"" + object + "\"";
+        if (std::system(command.c_str()) != 0) {
+            std::cerr << "Compilation failed for pattern " << p.name << ": " << command << "\n";
+            return 1;
+        }
+
+        size_result r;
+        if (!measure_object(nm, object, work_dir, r))
+            return 2;
+
+        results.push_back({ p.name, { double(r.text_bytes), double(r.symbols), double(r.name_bytes) } });
+        std::printf("%-16s %12zu %9zu %12zu\n", p.name, r.text_bytes, r.symbols, r.name_bytes);
+
+        if (max_text != 0 && r.text_bytes > max_text) {
+            std::cerr << p.name << ": " << r.text_bytes << " text bytes, limit " << max_text << "\n";
+            exceeded = true;
+        }
+        if (max_names != 0 && r.name_bytes > max_names) {
+            std::cerr << p.name << ": " << r.name_bytes << " name bytes, limit " << max_names << "\n";
+            exceeded = true;
+        }
+    }
+
+    if (!save_file.empty())
+        save_results(save_file, results);
+
+    if (exceeded)
+        std::cerr << "Code size limit exceeded\n";
+
+    if (!baseline_file.empty()) {
+        int status = compare_to_baseline(baseline_file, results, { "text bytes", "symbols", "name bytes" }, tolerance);
+        if (status == 1)
+            std::cerr << "Code size regression exceeding a factor " << tolerance << "\n";
+        if (status != 0)
+            return status;
+    }
+
+    return exceeded ? 1 : 0;
+}
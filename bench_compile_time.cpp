@@ -0,0 +1,270 @@
+// Compile time scaling benchmark for named.h and tuple_support.h.
+//
+// For each size N this generates a translation unit with N value_names, a parameter_binder with N parameters called with all N
+// arguments in reverse order, and calls to tuple_concat, tuple_erase and tuple_find on N element tuples. Each translation unit is
+// compiled (without optimization, it is the front end we are measuring) and the wall time and peak memory of the compiler are
+// reported. Comparing the rows shows where instantiation cost grows faster than linearly.
+//
+// With --module the module interface named.cppm is built first and each translation unit is compiled twice, once including
+// named.h and once importing the module, to show the per translation unit cost of parsing the headers. This works with gcc and,
+// given --clang, with clang.
+//
+// Usage: bench_compile_time <compiler> <source dir> <work dir> [--msvc] [--clang] [--module] [--sizes=4,16,64,128]
+//                           [--baseline=file] [--tolerance=1.5] [--save=file]
+//
+// With --baseline the results are compared to a file previously written by --save, and the program fails if any size got slower
+// or uses more memory than the baseline times the tolerance. With --module these are the results of the importing translation
+// units.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_options.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+
+struct run_result {
+    int status = -1;
+    double seconds = 0;
+    long peak_kb = 0;       // Peak resident memory of the process and its children, 0 if not available.
+};
+
+
+// Run a command line and measure it. On POSIX the command is run by /bin/sh and wait4 reports the peak memory of the entire
+// process tree, which includes the actual compiler process (cc1plus and friends) started by the compiler driver.
+static run_result run_command(const std::string& command)
+{
+    run_result ret;
+    auto start = std::chrono::steady_clock::now();
+
+#ifdef _WIN32
+    STARTUPINFOA si{};
+    si.cb = sizeof(si);
+    PROCESS_INFORMATION pi{};
+    std::string line = command;
+    if (!CreateProcessA(nullptr, line.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &si, &pi))
+        return ret;
+
+    WaitForSingleObject(pi.hProcess, INFINITE);
+    DWORD code = 0;
+    GetExitCodeProcess(pi.hProcess, &code);
+    ret.status = int(code);
+
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (GetProcessMemoryInfo(pi.hProcess, &pmc, sizeof(pmc)))
+        ret.peak_kb = long(pmc.PeakWorkingSetSize / 1024);
+
+    CloseHandle(pi.hThread);
+    CloseHandle(pi.hProcess);
+#else
+    pid_t pid = fork();
+    if (pid == 0) {
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    if (pid < 0)
+        return ret;
+
+    int status = 0;
+    rusage usage{};
+    if (wait4(pid, &status, 0, &usage) < 0)
+        return ret;
+
+    ret.status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#ifdef __APPLE__
+    ret.peak_kb = usage.ru_maxrss / 1024;      // bytes on macOS
+#else
+    ret.peak_kb = usage.ru_maxrss;             // kilobytes on Linux
+#endif
+#endif
+
+    ret.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return ret;
+}
+
+
+// Generate the source of the translation unit for size n, either including named.h or importing the named module. The module
+// doesn't export the standard library, so the importing translation unit includes the headers it uses itself.
+static std::string generate_source(size_t n, bool module)
+{
+    std::ostringstream os;
+    os << "// Generated by bench_compile_time for " << n << " named parameters.\n";
+    if (module)
+        os << "#include <optional>\n#include <tuple>\n#include <utility>\nimport named;\n\n";
+    else
+        os << "#include \"named.h\"\n\n";
+
+    for (size_t i = 0; i < n; i++) {
+        os << "inline const char* p" << i << "_tag = \"p" << i << "\";\n";
+        os << "std::value_name<p" << i << "_tag> p" << i << ";\n";
+    }
+
+    // Binding all parameters, with the arguments given in reverse order so that every lookup has to scan.
+    os << "\ntemplate<typename... Ps> int bench_function(Ps&&... ps)\n{\n";
+    os << "    std::parameter_binder binder(";
+    for (size_t i = 0; i < n; i++)
+        os << (i ? ", " : "") << "p" << i << ".optional<int>()";
+    os << ");\n";
+    os << "    auto args = binder.bind(std::forward<Ps>(ps)...);\n";
+    os << "    return *std::get<p0>(args) + *std::get<p" << n - 1 << ">(args);\n}\n\n";
+
+    os << "int bench_bind()\n{\n    return bench_function(";
+    for (size_t i = n; i-- > 0;)
+        os << "p" << i << " = " << i << (i ? ", " : "");
+    os << ");\n}\n\n";
+
+    // The tuple_support algorithms on n element tuples.
+    os << "using ints = std::tuple<";
+    for (size_t i = 0; i < n; i++)
+        os << (i ? ", " : "") << "int";
+    os << ">;\n";
+
+    os << "using named_args = std::tuple<";
+    for (size_t i = 0; i < n; i++)
+        os << (i ? ", " : "") << "std::named_value<p" << i << "_tag, int>";
+    os << ">;\n\n";
+
+    os << "int bench_tuple(const ints& t)\n{\n";
+    os << "    auto c = std::tuple_concat(t, t);\n";
+    os << "    auto e = std::tuple_erase<" << n / 2 << ">(c);\n";
+    os << "    static_assert(std::tuple_find<p" << n - 1 << "_tag, named_args>() == " << n - 1 << ");\n";
+    os << "    return std::get<0>(e) + std::get<" << n << ">(e);\n}\n";
+
+    return os.str();
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) {
+        std::cerr << "Usage: bench_compile_time <compiler> <source dir> <work dir> [--msvc] [--clang] [--module] [--sizes=4,16,64,128] [--baseline=file] [--tolerance=1.5] [--save=file]\n";
+        return 2;
+    }
+
+    std::string compiler = argv[1];
+    std::string source_dir = argv[2];
+    std::string work_dir = argv[3];
+    bool msvc = false;
+    bool clang = false;
+    bool module = false;
+    std::vector<size_t> sizes = { 4, 16, 64, 128 };
+    std::string baseline_file, save_file;
+    double tolerance = 1.5;
+
+    for (int i = 4; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--msvc")
+            msvc = true;
+        else if (arg == "--clang")
+            clang = true;
+        else if (arg == "--module")
+            module = true;
+        else if (auto v = option_value(arg, "sizes"); !v.empty()) {
+            sizes.clear();
+            std::istringstream is(v);
+            for (std::string s; std::getline(is, s, ',');)
+                sizes.push_back(std::stoul(s));
+        }
+        else if (auto v = option_value(arg, "baseline"); !v.empty())
+            baseline_file = v;
+        else if (auto v = option_value(arg, "tolerance"); !v.empty())
+            tolerance = std::stod(v);
+        else if (auto v = option_value(arg, "save"); !v.empty())
+            save_file = v;
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return 2;
+        }
+    }
+
+    if (module && msvc) {
+        std::cerr << "--module is only supported for gcc and clang\n";
+        return 2;
+    }
+
+    // The module interface is built once. gcc writes the compiled interface to gcm.cache in the current directory, where the
+    // importers look for it, so all module compilations are run in the work directory.
+    std::string module_flags;
+    if (module) {
+        std::string interface = "\"" + source_dir + "/named.cppm\"";
+        std::string command = clang ?
+            "\"" + compiler + "\" -std=c++20 --precompile -I\"" + source_dir + "\" " + interface + " -o \"" + work_dir + "/named.pcm\"" :
+            "cd \"" + work_dir + "\" && \"" + compiler + "\" -std=c++20 -fmodules-ts -I\"" + source_dir + "\" -x c++ -c " + interface + " -o named_module.o";
+        module_flags = clang ? "-fmodule-file=named=\"" + work_dir + "/named.pcm\"" : "-fmodules-ts";
+
+        run_result r = run_command(command);
+        if (r.status != 0) {
+            std::cerr << "Compilation of the module interface failed: " << command << "\n";
+            return 1;
+        }
+
+        std::printf("module interface: %.2f s, %.1f MB\n", r.seconds, r.peak_kb / 1024.0);
+    }
+
+    std::vector<bench_result> results;
+    std::cout << (module ? "params      seconds     peak MB      header s   header MB\n" : "params      seconds     peak MB\n");
+    for (size_t n : sizes) {
+        std::string source = work_dir + "/compile_scaling_" + std::to_string(n) + ".cpp";
+        std::string object = work_dir + "/compile_scaling_" + std::to_string(n) + (msvc ? ".obj" : ".o");
+        std::ofstream(source) << generate_source(n, false);
+
+        std::string command = msvc ?
+            "\"" + compiler + "\" /nologo /std:c++latest /EHsc /c /I\"" + source_dir + "\" \"" + source + "\" /Fo\"" + object + "\"" :
+            "\"" + compiler + "\" -std=c++20 -c -I\"" + source_dir + "\" \"" + source + "\" -o \"" + object + "\"";
+
+        run_result r = run_command(command);
+        if (r.status != 0) {
+            std::cerr << "Compilation failed for " << n << " parameters: " << command << "\n";
+            return 1;
+        }
+
+        if (!module) {
+            results.push_back({ std::to_string(n), { r.seconds, double(r.peak_kb) } });
+            std::printf("%6zu %12.2f %11.1f\n", n, r.seconds, r.peak_kb / 1024.0);
+            continue;
+        }
+
+        std::string import_source = work_dir + "/compile_scaling_import_" + std::to_string(n) + ".cpp";
+        std::string import_object = work_dir + "/compile_scaling_import_" + std::to_string(n) + ".o";
+        std::ofstream(import_source) << generate_source(n, true);
+
+        std::string import_command = "cd \"" + work_dir + "\" && \"" + compiler + "\" -std=c++20 " + module_flags + " -c \"" + import_source + "\" -o \"" + import_object + "\"";
+        run_result ir = run_command(import_command);
+        if (ir.status != 0) {
+            std::cerr << "Compilation failed for " << n << " parameters: " << import_command << "\n";
+            return 1;
+        }
+
+        results.push_back({ std::to_string(n), { ir.seconds, double(ir.peak_kb) } });
+        std::printf("%6zu %12.2f %11.1f %13.2f %11.1f\n", n, ir.seconds, ir.peak_kb / 1024.0, r.seconds, r.peak_kb / 1024.0);
+    }
+
+    if (!save_file.empty())
+        save_results(save_file, results);
+
+    if (!baseline_file.empty()) {
+        int status = compare_to_baseline(baseline_file, results, { "s", "kB" }, tolerance);
+        if (status == 1)
+            std::cerr << "Compile time regression exceeding a factor " << tolerance << "\n";
+        if (status != 0)
+            return status;
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Command line options and baseline files shared by the compile time and code size benchmarks.
+//
+// A benchmark measures a number of cases, such as parameter counts or call patterns, with the same metrics for each case. The
+// results are saved as one line per case: The case name followed by its metrics. When the results are compared to such a baseline
+// file a metric regresses if it is larger than the baseline times the tolerance. A baseline metric of 0 was not measured and is
+// not compared.
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+// The value of the option --name=value in arg, or an empty string if arg is not that option.
+inline std::string option_value(const std::string& arg, const std::string& name)
+{
+    std::string prefix = "--" + name + "=";
+    return arg.compare(0, prefix.size(), prefix) == 0 ? arg.substr(prefix.size()) : std::string();
+}
+
+
+struct bench_result {
+    std::string name;
+    std::vector<double> metrics;
+};
+
+inline void save_results(const std::string& file, const std::vector<bench_result>& results)
+{
+    std::ofstream os(file);
+    os.precision(15);
+    for (auto& r : results) {
+        os << r.name;
+        for (double m : r.metrics)
+            os << " " << m;
+        os << "\n";
+    }
+}
+
+// Compare results to a baseline file written by save_results, reporting each regressed metric by its unit. Cases missing from
+// either the results or the baseline are skipped. Returns 0 if nothing regressed, 1 on regressions and 2 if the baseline can't
+// be read.
+inline int compare_to_baseline(const std::string& file, const std::vector<bench_result>& results, const std::vector<std::string>& units, double tolerance)
+{
+    std::ifstream is(file);
+    if (!is) {
+        std::cerr << "Can't read baseline " << file << "\n";
+        return 2;
+    }
+
+    bool regressed = false;
+    for (std::string line; std::getline(is, line);) {
+        std::istringstream ls(line);
+        bench_result base;
+        ls >> base.name;
+        for (double m; ls >> m;)
+            base.metrics.push_back(m);
+
+        for (auto& r : results) {
+            if (r.name != base.name)
+                continue;
+
+            for (size_t ix = 0; ix < r.metrics.size() && ix < base.metrics.size() && ix < units.size(); ix++) {
+                if (base.metrics[ix] != 0 && r.metrics[ix] > base.metrics[ix] * tolerance) {
+                    std::cerr << r.name << ": " << r.metrics[ix] << " " << units[ix] << ", baseline " << base.metrics[ix] << "\n";
+                    regressed = true;
+                }
+            }
+        }
+    }
+
+    return regressed ? 1 : 0;
+}
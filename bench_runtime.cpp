@@ -0,0 +1,462 @@
+// Runtime overhead benchmark and code generation check for named parameters.
+//
+// Each case consists of a function taking named parameters through parameter_binder and the equivalent hand written function
+// with positional parameters and default arguments, each called from a non-inlined call site wrapper. The benchmark reports the
+// time per call of both wrappers.
+//
+// In check mode this file itself is compiled to assembly with -O2 and the number of instructions in each pair of call site
+// wrappers is compared. Any instructions the named version has in addition to the positional version are listed, and the program
+// fails if there are more of them than the known overhead of the case. This works with compilers producing gcc style assembly
+// output, i.e. gcc and clang.
+//
+// The ints and string cases are repeated with 1, 4 and 16 parameters to show how the overhead depends on the parameter count.
+//
+// Usage: bench_runtime [--iterations=10000000]
+//        bench_runtime --check <compiler> <this source file> <work dir>
+
+#include "named.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Besides not inlining, gcc must not use what it learns about the wrappers when optimizing the benchmark loops.
+#ifdef _MSC_VER
+#define BENCH_NOINLINE __declspec(noinline)
+#elif defined(__GNUC__) && !defined(__clang__)
+#define BENCH_NOINLINE __attribute__((noinline, noipa))
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+
+inline const char* first_tag = "first";
+std::value_name<first_tag> first;
+inline const char* second_tag = "second";
+std::value_name<second_tag> second;
+inline const char* third_tag = "third";
+std::value_name<third_tag> third;
+inline const char* fourth_tag = "fourth";
+std::value_name<fourth_tag> fourth;
+
+// Names for the cases sweeping over the number of parameters.
+std::value_name<"p1"> p1;
+std::value_name<"p2"> p2;
+std::value_name<"p3"> p3;
+std::value_name<"p4"> p4;
+std::value_name<"p5"> p5;
+std::value_name<"p6"> p6;
+std::value_name<"p7"> p7;
+std::value_name<"p8"> p8;
+std::value_name<"p9"> p9;
+std::value_name<"p10"> p10;
+std::value_name<"p11"> p11;
+std::value_name<"p12"> p12;
+std::value_name<"p13"> p13;
+std::value_name<"p14"> p14;
+std::value_name<"p15"> p15;
+std::value_name<"p16"> p16;
+
+struct Point {
+    Point(int x, int y) : x(x), y(y) {}
+    int x, y;
+};
+
+
+//////////////// The cases. Defaults which own memory use a static const binder, as recommended. ////////////////
+
+template<typename... Ps> inline int ints_1_named(Ps&&... ps)
+{
+    const std::parameter_binder binder(first = 0);
+    auto args = binder.bind(std::forward<Ps>(ps)...);
+    return std::get<first>(args);
+}
+inline int ints_1_positional(int a = 0)
+{
+    return a;
+}
+
+template<typename... Ps> inline int ints_4_named(Ps&&... ps)
+{
+    const std::parameter_binder binder(first = 0, second = 0, third = 0, fourth = 0);
+    auto args = binder.bind(std::forward<Ps>(ps)...);
+    return std::get<first>(args) + std::get<second>(args) * 2 + std::get<third>(args) * 3 + std::get<fourth>(args) * 4;
+}
+inline int ints_4_positional(int a = 0, int b = 0, int c = 0, int d = 0)
+{
+    return a + b * 2 + c * 3 + d * 4;
+}
+
+template<typename... Ps> inline int ints_16_named(Ps&&... ps)
+{
+    const std::parameter_binder binder(p1 = 0, p2 = 0, p3 = 0, p4 = 0, p5 = 0, p6 = 0, p7 = 0, p8 = 0,
+                                       p9 = 0, p10 = 0, p11 = 0, p12 = 0, p13 = 0, p14 = 0, p15 = 0, p16 = 0);
+    auto args = binder.bind(std::forward<Ps>(ps)...);
+    return std::get<p1>(args) * 1 + std::get<p2>(args) * 2 + std::get<p3>(args) * 3 + std::get<p4>(args) * 4 +
+        std::get<p5>(args) * 5 + std::get<p6>(args) * 6 + std::get<p7>(args) * 7 + std::get<p8>(args) * 8 + std::get<p9>(args) * 9 +
+        std::get<p10>(args) * 10 + std::get<p11>(args) * 11 + std::get<p12>(args) * 12 + std::get<p13>(args) * 13 +
+        std::get<p14>(args) * 14 + std::get<p15>(args) * 15 + std::get<p16>(args) * 16;
+}
+inline int ints_16_positional(int a1 = 0, int a2 = 0, int a3 = 0, int a4 = 0, int a5 = 0, int a6 = 0, int a7 = 0, int a8 = 0,
+                              int a9 = 0, int a10 = 0, int a11 = 0, int a12 = 0, int a13 = 0, int a14 = 0, int a15 = 0,
+                              int a16 = 0)
+{
+    return a1 * 1 + a2 * 2 + a3 * 3 + a4 * 4 + a5 * 5 + a6 * 6 + a7 * 7 + a8 * 8 + a9 * 9 + a10 * 10 + a11 * 11 + a12 * 12 +
+        a13 * 13 + a14 * 14 + a15 * 15 + a16 * 16;
+}
+
+template<typename... Ps> inline int point_named(Ps&&... ps)
+{
+    const std::parameter_binder binder(third = Point{ 0, 0 });
+    auto args = binder.bind(std::forward<Ps>(ps)...);
+    const Point& p = std::get<third>(args);
+    return p.x * p.y;
+}
+inline int point_positional(const Point& p = Point{ 0, 0 })
+{
+    return p.x * p.y;
+}
+
+static const std::parameter_binder string_1_binder(second = std::string("Hopp"));
+template<typename... Ps> inline size_t string_1_named(Ps&&... ps)
+{
+    auto args = string_1_binder.bind(std::forward<Ps>(ps)...);
+    const std::string& s = std::get<second>(args);
+    return s.size();
+}
+inline size_t string_1_positional(const std::string& s = "Hopp")
+{
+    return s.size();
+}
+
+static const std::parameter_binder string_4_binder(p1 = std::string("Hopp"), p2 = std::string("Hopp"),
+                                                  p3 = std::string("Hopp"), p4 = std::string("Hopp"));
+template<typename... Ps> inline size_t string_4_named(Ps&&... ps)
+{
+    auto args = string_4_binder.bind(std::forward<Ps>(ps)...);
+    return std::get<p1>(args).size() + std::get<p2>(args).size() + std::get<p3>(args).size() + std::get<p4>(args).size();
+}
+inline size_t string_4_positional(const std::string& s1 = "Hopp", const std::string& s2 = "Hopp", const std::string& s3 = "Hopp",
+                                  const std::string& s4 = "Hopp")
+{
+    return s1.size() + s2.size() + s3.size() + s4.size();
+}
+
+static const std::parameter_binder string_16_binder(p1 = std::string("Hopp"), p2 = std::string("Hopp"), p3 = std::string("Hopp"), p4 = std::string("Hopp"),
+                                                    p5 = std::string("Hopp"), p6 = std::string("Hopp"), p7 = std::string("Hopp"), p8 = std::string("Hopp"),
+                                                    p9 = std::string("Hopp"), p10 = std::string("Hopp"), p11 = std::string("Hopp"), p12 = std::string("Hopp"),
+                                                    p13 = std::string("Hopp"), p14 = std::string("Hopp"), p15 = std::string("Hopp"), p16 = std::string("Hopp"));
+template<typename... Ps> inline size_t string_16_named(Ps&&... ps)
+{
+    auto args = string_16_binder.bind(std::forward<Ps>(ps)...);
+    return std::get<p1>(args).size() + std::get<p2>(args).size() + std::get<p3>(args).size() + std::get<p4>(args).size() +
+        std::get<p5>(args).size() + std::get<p6>(args).size() + std::get<p7>(args).size() + std::get<p8>(args).size() +
+        std::get<p9>(args).size() + std::get<p10>(args).size() + std::get<p11>(args).size() + std::get<p12>(args).size() +
+        std::get<p13>(args).size() + std::get<p14>(args).size() + std::get<p15>(args).size() + std::get<p16>(args).size();
+}
+inline size_t string_16_positional(const std::string& s1 = "Hopp", const std::string& s2 = "Hopp", const std::string& s3 = "Hopp",
+                                   const std::string& s4 = "Hopp", const std::string& s5 = "Hopp", const std::string& s6 = "Hopp",
+                                   const std::string& s7 = "Hopp", const std::string& s8 = "Hopp", const std::string& s9 = "Hopp",
+                                   const std::string& s10 = "Hopp", const std::string& s11 = "Hopp",
+                                   const std::string& s12 = "Hopp", const std::string& s13 = "Hopp",
+                                   const std::string& s14 = "Hopp", const std::string& s15 = "Hopp",
+                                   const std::string& s16 = "Hopp")
+{
+    return s1.size() + s2.size() + s3.size() + s4.size() + s5.size() + s6.size() + s7.size() + s8.size() + s9.size() + s10.size() +
+        s11.size() + s12.size() + s13.size() + s14.size() + s15.size() + s16.size();
+}
+
+template<typename... Ps> inline int optional_named(Ps&&... ps)
+{
+    const std::parameter_binder binder(first.optional<int>());
+    auto args = binder.bind(std::forward<Ps>(ps)...);
+    return std::get<first>(args).value_or(-1);
+}
+inline int optional_positional(std::optional<int> v = std::nullopt)
+{
+    return v.value_or(-1);
+}
+
+static const std::parameter_binder variant_binder(second.variant<std::string, Point>("Hopp"));
+template<typename... Ps> inline int variant_named(Ps&&... ps)
+{
+    auto args = variant_binder.bind(std::forward<Ps>(ps)...);
+    const auto& v = std::get<second>(args);
+    if (auto p = std::get_if<Point>(&v))
+        return p->x + p->y;
+    return int(std::get<std::string>(v).size());
+}
+inline int variant_positional(const std::variant<std::string, Point>& v = "Hopp")
+{
+    if (auto p = std::get_if<Point>(&v))
+        return p->x + p->y;
+    return int(std::get<std::string>(v).size());
+}
+
+static const std::parameter_binder any_binder(fourth.any(8));
+template<typename... Ps> inline int any_named(Ps&&... ps)
+{
+    auto args = any_binder.bind(std::forward<Ps>(ps)...);
+    const std::any& v = std::get<fourth>(args);
+    if (auto ip = std::any_cast<int>(&v))
+        return *ip;
+    return 0;
+}
+inline int any_positional(const std::any& v = 8)
+{
+    if (auto ip = std::any_cast<int>(&v))
+        return *ip;
+    return 0;
+}
+
+template<typename... Ps> inline int small_any_named(Ps&&... ps)
+{
+    const std::parameter_binder binder(fourth.small_any(8));
+    auto args = binder.bind(std::forward<Ps>(ps)...);
+    const std::small_any<>& v = std::get<fourth>(args);
+    if (auto ip = v.get_if<int>())
+        return *ip;
+    return 0;
+}
+inline int small_any_positional(const std::small_any<>& v = 8)
+{
+    if (auto ip = v.get_if<int>())
+        return *ip;
+    return 0;
+}
+
+
+
+//////////////// Call site wrappers, compared pairwise in check mode ////////////////
+
+extern "C" {
+
+BENCH_NOINLINE int call_named_ints_1(int a, int) { return ints_1_named(first = a); }
+BENCH_NOINLINE int call_positional_ints_1(int a, int) { return ints_1_positional(a); }
+
+BENCH_NOINLINE int call_named_ints_4(int a, int c) { return ints_4_named(third = c, first = a); }
+BENCH_NOINLINE int call_positional_ints_4(int a, int c) { return ints_4_positional(a, 0, c); }
+
+BENCH_NOINLINE int call_named_ints_16(int a, int c) { return ints_16_named(p11 = c, p2 = a); }
+BENCH_NOINLINE int call_positional_ints_16(int a, int c) { return ints_16_positional(0, a, 0, 0, 0, 0, 0, 0, 0, 0, c); }
+
+BENCH_NOINLINE int call_named_point(int x, int y) { return point_named(third(x, y)); }
+BENCH_NOINLINE int call_positional_point(int x, int y) { return point_positional(Point{ x, y }); }
+
+BENCH_NOINLINE size_t call_named_string_1(const std::string& s) { return string_1_named(second = s); }
+BENCH_NOINLINE size_t call_positional_string_1(const std::string& s) { return string_1_positional(s); }
+
+BENCH_NOINLINE size_t call_named_string_4(const std::string& s) { return string_4_named(p2 = s); }
+BENCH_NOINLINE size_t call_positional_string_4(const std::string& s) { return string_4_positional("Hopp", s); }
+
+BENCH_NOINLINE size_t call_named_string_16(const std::string& s) { return string_16_named(p11 = s); }
+BENCH_NOINLINE size_t call_positional_string_16(const std::string& s)
+{
+    return string_16_positional("Hopp", "Hopp", "Hopp", "Hopp", "Hopp", "Hopp", "Hopp", "Hopp", "Hopp", "Hopp", s);
+}
+
+BENCH_NOINLINE int call_named_optional(int v) { return optional_named(first = v); }
+BENCH_NOINLINE int call_positional_optional(int v) { return optional_positional(v); }
+
+BENCH_NOINLINE int call_named_variant(int x, int y) { return variant_named(second = Point{ x, y }); }
+BENCH_NOINLINE int call_positional_variant(int x, int y) { return variant_positional(Point{ x, y }); }
+
+BENCH_NOINLINE int call_named_any(int v) { return any_named(fourth = v); }
+BENCH_NOINLINE int call_positional_any(int v) { return any_positional(v); }
+
+BENCH_NOINLINE int call_named_small_any(int v) { return small_any_named(fourth = v); }
+BENCH_NOINLINE int call_positional_small_any(int v) { return small_any_positional(v); }
+
+}
+
+// The cases compared in check mode. Some named versions are known to need instructions that the positional versions don't, and
+// known_extra is how many of them are allowed, as measured with gcc on x86-64.
+struct check_case {
+    const char* name;
+    size_t known_extra;
+    const char* reason;
+};
+static const check_case check_cases[] = {
+    { "ints_1", 0, "" },
+    { "ints_4", 0, "" },
+    { "ints_16", 0, "" },
+    { "point", 0, "" },
+    { "string_1", 0, "" },
+    { "string_4", 2, "the sizes of the defaults are read from the binder instead of folded from the literals" },
+    { "string_16", 14, "the sizes of the defaults are read from the binder instead of folded from the literals" },
+    { "optional", 0, "" },
+    { "variant", 0, "" },
+    { "any", 0, "" },
+    { "small_any", 0, "" },
+};
+
+
+//////////////// Benchmark ////////////////
+
+// Time F over iterations calls, returning ns per call. The results are accumulated to keep the calls from being removed.
+template<typename F> double time_calls(size_t iterations, F f)
+{
+    volatile size_t sink = 0;
+    size_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+        sum += size_t(f(int(i & 1023)));
+    auto end = std::chrono::steady_clock::now();
+    sink = sum;
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / double(iterations);
+}
+
+static void run_benchmark(size_t iterations)
+{
+    const std::string text = "a string long enough not to fit in the small buffer";
+    struct bench_case {
+        const char* name;
+        double named;
+        double positional;
+    };
+    std::vector<bench_case> cases = {
+        { "ints_1", time_calls(iterations, [](int i) { return call_named_ints_1(i, i + 1); }),
+                    time_calls(iterations, [](int i) { return call_positional_ints_1(i, i + 1); }) },
+        { "ints_4", time_calls(iterations, [](int i) { return call_named_ints_4(i, i + 1); }),
+                    time_calls(iterations, [](int i) { return call_positional_ints_4(i, i + 1); }) },
+        { "ints_16", time_calls(iterations, [](int i) { return call_named_ints_16(i, i + 1); }),
+                     time_calls(iterations, [](int i) { return call_positional_ints_16(i, i + 1); }) },
+        { "point", time_calls(iterations, [](int i) { return call_named_point(i, i + 1); }),
+                   time_calls(iterations, [](int i) { return call_positional_point(i, i + 1); }) },
+        { "string_1", time_calls(iterations, [&](int) { return call_named_string_1(text); }),
+                      time_calls(iterations, [&](int) { return call_positional_string_1(text); }) },
+        { "string_4", time_calls(iterations, [&](int) { return call_named_string_4(text); }),
+                      time_calls(iterations, [&](int) { return call_positional_string_4(text); }) },
+        { "string_16", time_calls(iterations, [&](int) { return call_named_string_16(text); }),
+                       time_calls(iterations, [&](int) { return call_positional_string_16(text); }) },
+        { "optional", time_calls(iterations, [](int i) { return call_named_optional(i); }),
+                      time_calls(iterations, [](int i) { return call_positional_optional(i); }) },
+        { "variant", time_calls(iterations, [](int i) { return call_named_variant(i, i + 1); }),
+                     time_calls(iterations, [](int i) { return call_positional_variant(i, i + 1); }) },
+        { "any", time_calls(iterations, [](int i) { return call_named_any(i); }),
+                 time_calls(iterations, [](int i) { return call_positional_any(i); }) },
+        { "small_any", time_calls(iterations, [](int i) { return call_named_small_any(i); }),
+                       time_calls(iterations, [](int i) { return call_positional_small_any(i); }) },
+    };
+
+    std::cout << "case         named ns/call   positional ns/call\n";
+    for (auto& c : cases)
+        std::printf("%-10s %15.2f %20.2f\n", c.name, c.named, c.positional);
+}
+
+
+//////////////// Code generation check ////////////////
+
+// Extract the instruction mnemonics of a function from gcc style assembly, including any .cold part split off by the compiler.
+static std::vector<std::string> function_instructions(const std::string& assembly, const std::string& function)
+{
+    std::vector<std::string> ret;
+    for (std::string label : { function + ":", function + ".cold:" }) {
+        std::istringstream is(assembly);
+        bool inside = false;
+        for (std::string line; std::getline(is, line);) {
+            if (!inside) {
+                inside = line == label;
+                continue;
+            }
+
+            std::istringstream ls(line);
+            std::string mnemonic;
+            ls >> mnemonic;
+            if (mnemonic == ".size" || mnemonic == ".cfi_endproc")
+                break;
+            if (mnemonic.empty() || mnemonic[0] == '.' || mnemonic[0] == '#' || mnemonic.back() == ':')
+                continue;
+
+            ret.push_back(mnemonic);
+        }
+    }
+
+    return ret;
+}
+
+static int run_check(const std::string& compiler, const std::string& source, const std::string& work_dir)
+{
+    std::string source_dir = source.substr(0, source.find_last_of("/\\") + 1);
+    std::string output = work_dir + "/bench_runtime.s";
+    std::string command = "\"" + compiler + "\" -std=c++20 -O2 -S -fno-asynchronous-unwind-tables -I\"" + source_dir + "\" \"" + source + "\" -o \"" + output + "\"";
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "Compilation failed: " << command << "\n";
+        return 2;
+    }
+
+    std::ifstream is(output);
+    std::stringstream assembly;
+    assembly << is.rdbuf();
+
+    bool exceeded = false;
+    std::cout << "case        named  positional  known  extra instructions\n";
+    for (const check_case& c : check_cases) {
+        auto named = function_instructions(assembly.str(), std::string("call_named_") + c.name);
+        auto positional = function_instructions(assembly.str(), std::string("call_positional_") + c.name);
+        if (named.empty() || positional.empty()) {
+            std::cerr << "Function for case " << c.name << " not found in " << output << "\n";
+            return 2;
+        }
+
+        // The instructions of the named version not matched by an instruction with the same mnemonic in the positional version.
+        std::map<std::string, int> counts;
+        for (auto& m : positional)
+            counts[m]++;
+        std::string added;
+        size_t extra = 0;
+        for (auto& m : named) {
+            if (counts[m]-- <= 0) {
+                added += " " + m;
+                extra++;
+            }
+        }
+
+        std::printf("%-10s %6zu %11zu %6zu %s\n", c.name, named.size(), positional.size(), c.known_extra, added.c_str());
+        if (extra > c.known_extra) {
+            std::cerr << "Named parameters add " << extra << " instructions in case " << c.name << ", " << c.known_extra << " expected\n";
+            exceeded = true;
+        }
+        else if (extra < c.known_extra)
+            std::cout << "Case " << c.name << " has " << extra << " extra instructions, the known overhead can be lowered\n";
+        if (c.known_extra > 0)
+            std::cout << "    known overhead: " << c.reason << "\n";
+    }
+
+    if (exceeded)
+        return 1;
+
+    return 0;
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2 && std::string(argv[1]) == "--check") {
+        if (argc != 5) {
+            std::cerr << "Usage: bench_runtime --check <compiler> <this source file> <work dir>\n";
+            return 2;
+        }
+        return run_check(argv[2], argv[3], argv[4]);
+    }
+
+    size_t iterations = 10000000;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg.compare(0, 13, "--iterations=") == 0)
+            iterations = std::stoul(arg.substr(13));
+        else {
+            std::cerr << "Unknown option " << arg << "\n";
+            return 2;
+        }
+    }
+
+    run_benchmark(iterations);
+    return 0;
+}
@@ -0,0 +1,41 @@
+// C++20 module interface for named.h and tuple_support.h: import named; instead of #include "named.h".
+//
+// The standard library headers are included in the global module fragment, so they are parsed once when the module is built
+// instead of in every translation unit. They are not exported: Translation units which use standard library names such as
+// std::tuple or std::optional directly must include the corresponding headers, before the import as gcc requires.
+//
+// The library itself is exported with C++ language linkage, so that its entities stay attached to the global module and the
+// same named_value or parameter_binder type can be used by translation units including named.h and ones importing the module.
+//
+// Build with gcc: g++ -std=c++20 -fmodules-ts -x c++ -c named.cppm, which also writes gcm.cache/named.gcm for the importers.
+// Build with clang: clang++ -std=c++20 --precompile named.cppm -o named.pcm, and import with -fmodule-file=named=named.pcm.
+// See the named_module target in cmakelists.txt.
+
+module;
+
+#include <type_traits>
+#include <tuple>
+#include <array>
+#include <utility>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <string_view>
+#include <cstdint>
+#include <vector>
+#include <iterator>
+#include <limits>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <variant>
+#include <any>
+#include <cstddef>
+#include <cstring>
+#include <new>
+
+export module named;
+
+export extern "C++" {
+#include "named.h"
+}
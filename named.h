@@ -5,11 +5,21 @@
 
 #include <memory>
 #include <functional>
+#include <string_view>
+#include <cstdint>
+#include <vector>
+#include <iterator>
+#include <limits>
+#include <atomic>
+#include <mutex>
 
 // For the corresponding functionality of named_value
 #include <optional>
 #include <variant>
 #include <any>
+#include <cstddef>
+#include <cstring>
+#include <new>
 
 // This library is similar in purpose to boost Parameter (https://www.boost.org/doc/libs/1_72_0/libs/parameter/doc/html/index.html).
 
@@ -31,79 +41,421 @@ template<typename T> using array_to_pointer_t = typename array_to_pointer<T>::ty
 
 //////////////// named_values and value_name are building blocks for named parameter handling ////////////////
 
-// value_name_tag should be a fixed_string of fixed max length. To make this work with current compilers it is currently replaced by
-// a const char* which means that it is the identity (variable name) rather than the characters in the string that we are templating
-// on. This means that it is not allowed to violate the ODR rule and declare the same value_name in different headers.
-using value_name_tag = const char*&;
+// fixed_string<N> holds the N characters of a name given as a string literal. It is the object the named_values of such a name
+// refer to, see value_name_tag.
+template<size_t N> struct fixed_string {
+    constexpr string_view view() const { return string_view(chars, N); }
+
+    char chars[N];
+};
+
+// value_name_tag is a name as given to value_name, either a string literal, as in value_name<"first">, or for compatibility a
+// const char* variable, as in value_name<first_tag>. Literal names are stored by value and compare by content, so the same name
+// can be declared in several headers. Names given as a variable are identified by the address of the variable rather than the
+// characters in the string, which means that it is not allowed to violate the ODR rule and declare the same value_name in
+// different headers.
+//
+// named_value and the other class templates holding values take the name as a reference to an object instead, the tag variable
+// itself or the fixed_string of a literal name, see detail::name_object. Function signatures mention these types, so this keeps
+// the mangled names of tag variable names as they were before literal names were added, and avoids mangling max_size characters
+// for literal names. value_name_tag is also the identity of the name in the constexpr name lookups, and is constructed from
+// either of the name objects for this.
+struct value_name_tag {
+    static constexpr size_t max_size = 32;
+
+    constexpr value_name_tag() = default;        // No name, used for elements that are not named.
+    template<size_t N> constexpr value_name_tag(const char (&str)[N]) {
+        static_assert(N > 1 && N - 1 <= max_size, "A value_name must have between 1 and max_size characters");
+        for (size_t i = 0; i < N - 1; i++)
+            chars[i] = str[i];
+    }
+    template<size_t N> constexpr value_name_tag(const fixed_string<N>& str) {
+        static_assert(N > 0 && N <= max_size, "A value_name must have between 1 and max_size characters");
+        for (size_t i = 0; i < N; i++)
+            chars[i] = str.chars[i];
+    }
+    // A template so that string literals don't decay to select this constructor.
+    template<typename P> requires is_same_v<P, const char*> constexpr value_name_tag(const P& tag_variable) : tag(&tag_variable) {}
+
+    constexpr bool operator==(const value_name_tag&) const = default;
+
+    // The characters of the name. Empty for names given as a const char* variable.
+    constexpr string_view view() const {
+        size_t size = 0;
+        while (size < max_size && chars[size] != 0)
+            size++;
+        return string_view(chars, size);
+    }
+
+    // Characters 8 * ix to 8 * ix + 7 packed into a word, the first character in the low byte.
+    constexpr uint64_t word(size_t ix) const {
+        uint64_t ret = 0;
+        for (size_t i = 0; i < 8 && 8 * ix + i < max_size; i++)
+            ret |= uint64_t(uint8_t(chars[8 * ix + i])) << (8 * i);
+        return ret;
+    }
+
+    // The members must be public for value_name_tag to be usable as a template parameter. Trailing zero members are left out of
+    // mangled names, so chars goes first.
+    char chars[max_size] = {};
+    const char* const* tag = nullptr;
+};
 
 // Forward declare the value_name class template.
 template<value_name_tag Name> class value_name;
 
 
+namespace detail {
+    // The fixed_string of a literal name. gcc mangles each element of a char array template argument as a separate literal, such
+    // as Lc102E for an f, so literal_name is instead keyed on the characters packed eight to a word.
+    template<uint64_t... WORDS> constexpr size_t unpacked_size()
+    {
+        size_t ret = 0;
+        for (uint64_t word : { WORDS... }) {
+            for (; word != 0; word >>= 8)
+                ret++;
+        }
+
+        return ret;
+    }
+
+    template<uint64_t... WORDS> constexpr fixed_string<unpacked_size<WORDS...>()> unpack_name()
+    {
+        constexpr uint64_t words[] = { WORDS... };
+        fixed_string<unpacked_size<WORDS...>()> ret{};
+        for (size_t ix = 0; ix < unpacked_size<WORDS...>(); ix++)
+            ret.chars[ix] = char(words[ix / 8] >> (8 * (ix % 8)));
+
+        return ret;
+    }
+
+    template<uint64_t... WORDS> inline constexpr auto literal_name = unpack_name<WORDS...>();
+
+    template<value_name_tag Name, size_t... IXs> constexpr const auto& literal_name_for(index_sequence<IXs...>)
+    {
+        return literal_name<Name.word(IXs)...>;
+    }
+
+    // The object the named_values of Name refer to: The tag variable for names given as a const char* variable, the
+    // literal_name of the characters for literal names.
+    template<value_name_tag Name> constexpr const auto& name_object()
+    {
+        if constexpr (Name.tag != nullptr)
+            return *Name.tag;
+        else
+            return literal_name_for<Name>(make_index_sequence<(Name.view().size() + 7) / 8>());
+    }
+
+    // A T which is not constructed until the named_value, or the parameter_binder or bind result element, that stores it is. make
+    // returns the T as a prvalue, so it is constructed in its final place with guaranteed copy elision. This allows types which
+    // can't be moved, and avoids moving the ones which can.
+    template<typename T, typename F> struct in_place_construction {
+        using type = T;
+        F make;
+    };
+
+    template<typename T, typename F> constexpr in_place_construction<T, F> construct_in_place(F make) { return { make }; }
+
+    template<typename T> struct is_in_place_construction : public false_type {};
+    template<typename T, typename F> struct is_in_place_construction<in_place_construction<T, F>> : public true_type {};
+
+    // True if converting an F to the arithmetic type T may lose information, as for double to int or int to unsigned. Unlike
+    // the narrowing rules of list-initialization this does not depend on whether the value is a constant, as arguments never
+    // are, and allows conversions from integers to floating point types which represent all their values, such as int to double.
+    template<typename F, typename T> constexpr bool is_narrowing()
+    {
+        if constexpr (!is_arithmetic_v<F> || !is_arithmetic_v<T> || is_same_v<F, T>)
+            return false;
+        else if constexpr (is_floating_point_v<F>)
+            return !is_floating_point_v<T> || numeric_limits<T>::digits < numeric_limits<F>::digits || numeric_limits<T>::max_exponent < numeric_limits<F>::max_exponent;
+        else if constexpr (is_floating_point_v<T>)
+            return numeric_limits<F>::digits > numeric_limits<T>::digits;
+        else
+            return numeric_limits<F>::digits > numeric_limits<T>::digits || (is_signed_v<F> && !is_signed_v<T>);
+    }
+
+    // A V can be stored as a T by converted_in_place: It is a T or a deferred construction of one, or converts implicitly to T,
+    // so explicit constructors are not used, without narrowing.
+    template<typename V, typename T> concept converts_without_narrowing = is_same_v<decay_t<V>, T> || is_in_place_construction<decay_t<V>>::value ||
+                                                                          (is_convertible_v<V, T> && !is_narrowing<remove_cvref_t<V>, T>());
+
+    // v converted to T by copy-initialization, constructed in place where it is stored. This is the one conversion of arguments
+    // to parameter types, used by make_named and when binding eagerly, lazily or through a layered_binder, so all give the same
+    // value.
+    template<typename T, typename V> constexpr decltype(auto) converted_in_place(V&& v)
+    {
+        static_assert(converts_without_narrowing<V, T>, "An argument must convert implicitly and without narrowing to its parameter type");
+        if constexpr (is_same_v<decay_t<V>, T> || is_in_place_construction<decay_t<V>>::value)
+            return forward<V>(v);
+        else
+            return construct_in_place<T>([&v]() -> T { return forward<V>(v); });
+    }
+}
+
 // named_value connects a value with a name and is returned from the various operators of value_name and can be retrieved from
 // tuples using special get overloads.
-template<value_name_tag Name, typename T> class named_value {
+template<const auto& Name, typename T> class named_value {
 public:
     using type = T;
-    static constexpr value_name_tag name = Name;
+    static constexpr const auto& name = Name;
 
     // The ctor from non-const reference is needed to avoid the template ctor from taking over. And when this is defined
     // the other copy constructors must also be manually defined.
-    named_value(const named_value& src) : value(forward<const decltype(src.value)>(src.value)) {}
-    named_value(named_value& src) : value(forward<decltype(src.value)>(src.value)) {}
-    named_value(named_value&&) = default;
+    constexpr named_value(const named_value& src) : value(forward<const decltype(src.value)>(src.value)) {}
+    constexpr named_value(named_value& src) : value(forward<decltype(src.value)>(src.value)) {}
+    constexpr named_value(named_value&&) = default;
 
     // Constructor from a value_name of same name, only available if T is bool
-    named_value(value_name<Name>&) {
+    constexpr named_value(value_name<Name>&) {
         static_assert(is_same_v<T, bool>, "only bool named_values can be constructed from a value_name object");
         value = true;  // Initialize here to make sure the static assert is the first compile error.
     }
 
     // Emplacing constructor.
-    template<typename... Ps> named_value(Ps&&... pars) : value{ std::forward<Ps>(pars)... } {}
+    template<typename... Ps> constexpr named_value(Ps&&... pars) : value{ std::forward<Ps>(pars)... } {}
+
+    // Constructor taking a deferred construction of the value, which is constructed in place.
+    template<typename F> constexpr named_value(detail::in_place_construction<T, F>&& construction) : value(construction.make()) {}
 
     T value;
 };
 
 // Deduction guide that selects bool as the type when a value_name is the parameter.
-template<value_name_tag Name> named_value(value_name<Name>&&)->named_value<Name, bool>;
+template<value_name_tag Name> named_value(value_name<Name>&&)->named_value<value_name<Name>::name, bool>;
+
+namespace detail {
+    // A value of type P is passed through by reference instead of being converted to T if P is T or a subclass of T. Non-class
+    // types are always passed by value.
+    template<typename T, typename P> constexpr bool binds_by_reference = is_base_of_v<decay_t<T>, decay_t<P>>;
+}
 
 // make_named passes references through if possible, i.e. if sizeof...Ps == 1 and Ps[0] is a subclass of T, else it
 // Returns a named_value with a by value T.
-template<value_name_tag Name, typename T, typename... Ps> auto make_named(Ps&&... ps)
+template<const auto& Name, typename T, typename... Ps> constexpr auto make_named(Ps&&... ps)
 {
     using TC = decay_t<T>;
     if constexpr (sizeof...(Ps) == 1) {
-        if constexpr (is_base_of_v<TC, decay_t<Ps>...>)
+        if constexpr ((detail::binds_by_reference<TC, Ps> && ...))
             return named_value<Name, decltype(forward<Ps>(ps))...>(forward<Ps>(ps)...);
         else
-            return named_value<Name, TC>(forward<Ps>(ps)...);
+            return named_value<Name, TC>(detail::converted_in_place<TC>(forward<Ps>(ps)...));
     }
     else
         return named_value<Name, TC>(forward<Ps>(ps)...);
 }
 
 // make_named_from_tuple passes references through if possible, i.e. if P is a subclass of T, else it
-// Returns a named_value with a by value T, constructed from P or if P is a tuple like its elements.
-template<value_name_tag Name, typename T, typename P> auto make_named_from_tuple(P&& p)
+// Returns a named_value with a by value T, constructed from P or if P is a tuple like its elements. Note that a P which is a
+// tuple-like of type T is passed through rather than exploded.
+template<const auto& Name, typename T, typename P> constexpr auto make_named_from_tuple(P&& p)
 {
     using TC = decay_t<T>;
-    if constexpr (is_tuple_like_v<decay_t<P>>)
-        return make_from_tuple<named_value<Name, T>>(forward<P>(p));
+    if constexpr (is_tuple_like_v<decay_t<P>> && !detail::binds_by_reference<TC, P>)
+        return named_value<Name, TC>(detail::construct_in_place<TC>([&p] { return make_from_tuple<TC>(forward<P>(p)); }));
     else
         return make_named<Name, TC>(forward<P>(p));
 }
 
 
+// lazy_named_value is what a named argument which needs a conversion to the parameter type T is bound as by
+// bind_lazy_parameters. It refers to the argument A and converts it on the first get<name>, so that arguments which are never
+// accessed are never converted. The converted value is kept for later accesses, except for small trivially copyable types which
+// are converted on each access and returned by value. Like the argument it refers to it is only valid until the function being
+// called returns.
+template<const auto& Name, typename T, typename A> class lazy_named_value {
+public:
+    using type = T;
+    static constexpr const auto& name = Name;
+
+    constexpr lazy_named_value(A&& arg) : m_arg(forward<A>(arg)) {}
+
+    constexpr decltype(auto) get() const {
+        if constexpr (by_value)
+            return convert(m_arg);
+        else {
+            if (!m_value) {
+                if constexpr (is_tuple_like_v<decay_t<A>>)
+                    m_value.emplace(detail::construct_in_place<T>([this] { return make_from_tuple<T>(forward<A>(m_arg)); }));
+                else
+                    m_value.emplace(detail::converted_in_place<T>(forward<A>(m_arg)));
+            }
+            return static_cast<const T&>(m_value->value);
+        }
+    }
+
+private:
+    static constexpr bool by_value = is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*);
+
+    static constexpr T convert(const remove_reference_t<A>& arg) { return make_named_from_tuple<Name, T>(arg).value; }
+
+    A&& m_arg;
+    mutable optional<named_value<Name, T>> m_value;
+};
+
+namespace detail {
+    template<typename T> struct is_lazy_named : public false_type {};
+    template<const auto& Name, typename T, typename A> struct is_lazy_named<lazy_named_value<Name, T, A>> : public true_type {};
+    template<typename T> constexpr bool is_lazy_named_v = is_lazy_named<T>::value;
+}
+
+
+//////////////// small_any is an allocation free alternative to std::any for any parameters ////////////////
+
+// small_any stores values of any copyable type in an inline buffer of CAPACITY bytes. Types which don't fit are a compile error
+// unless ALLOW_HEAP is set, in which case they are allocated on the heap. Trivially copyable types are copied as raw bytes and
+// need no destruction, other types are handled by a manager with one function per operation. get_if is a pointer comparison.
+template<size_t CAPACITY = 3 * sizeof(void*), bool ALLOW_HEAP = false> class small_any {
+    static_assert(!ALLOW_HEAP || CAPACITY >= sizeof(void*), "small_any must have room for a pointer to allow heap allocation");
+
+public:
+    small_any() = default;
+    small_any(const small_any& src) { copy_from(src); }
+    small_any(small_any&& src) noexcept { move_from(src); }
+    template<typename T, typename = enable_if_t<!is_same_v<decay_t<T>, small_any>>> small_any(T&& value) { emplace<decay_t<T>>(std::forward<T>(value)); }
+    ~small_any() { reset(); }
+
+    small_any& operator=(const small_any& src) {
+        if (this != &src) {
+            reset();
+            copy_from(src);
+        }
+        return *this;
+    }
+    small_any& operator=(small_any&& src) noexcept {
+        if (this != &src) {
+            reset();
+            move_from(src);
+        }
+        return *this;
+    }
+    template<typename T, typename = enable_if_t<!is_same_v<decay_t<T>, small_any>>> small_any& operator=(T&& value) {
+        emplace<decay_t<T>>(std::forward<T>(value));
+        return *this;
+    }
+
+    template<typename T, typename... Ps> T& emplace(Ps&&... ps) {
+        static_assert(is_copy_constructible_v<T>, "small_any requires copyable types");
+        static_assert(fits<T> || ALLOW_HEAP, "Type too large for small_any. Increase CAPACITY or set ALLOW_HEAP");
+        // When replacing a value the new value is created before the old one is destroyed, as ps may refer to the old value.
+        T* ret;
+        if constexpr (fits<T>) {
+            if (!has_value())
+                ret = ::new (static_cast<void*>(m_storage)) T(std::forward<Ps>(ps)...);
+            else {
+                T value(std::forward<Ps>(ps)...);
+                reset();
+                ret = ::new (static_cast<void*>(m_storage)) T(std::move(value));
+            }
+        }
+        else {
+            ret = new T(std::forward<Ps>(ps)...);
+            reset();
+            ::new (static_cast<void*>(m_storage)) T*(ret);
+        }
+        m_manager = &manager_for<T>;
+        return *ret;
+    }
+
+    void reset() {
+        if (m_manager != nullptr && m_manager->destroy != nullptr)
+            m_manager->destroy(m_storage);
+        m_manager = nullptr;
+    }
+
+    bool has_value() const { return m_manager != nullptr; }
+
+    // Returns a pointer to the value if it is a T, else nullptr.
+    template<typename T> T* get_if() { return m_manager == &manager_for<T> ? object<T>() : nullptr; }
+    template<typename T> const T* get_if() const { return m_manager == &manager_for<T> ? object<T>() : nullptr; }
+
+private:
+    // Types stored in m_storage must be nothrow movable as the move operations of small_any are noexcept.
+    template<typename T> static constexpr bool fits = sizeof(T) <= CAPACITY && alignof(T) <= alignof(max_align_t) && is_nothrow_move_constructible_v<T>;
+
+    // nullptr functions mean that the storage can be copied with memcpy, and doesn't need destruction. move also destroys src.
+    // type points to a tag of its own for each type, so that the managers of types with the same functions, such as all trivially
+    // copyable types, are still different data which a linker can't fold into one.
+    struct manager {
+        const char* type;
+        void (*copy)(void* dst, const void* src);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* p);
+    };
+
+    template<typename T> static constexpr char type_tag = 0;
+
+    template<typename T> static constexpr manager make_manager() {
+        if constexpr (!fits<T>) {
+            return {
+                &type_tag<T>,
+                [](void* dst, const void* src) { ::new (dst) T*(new T(**static_cast<T* const*>(src))); },
+                nullptr,
+                [](void* p) { delete *static_cast<T**>(p); }
+            };
+        }
+        else if constexpr (is_trivially_copyable_v<T>)
+            return { &type_tag<T>, nullptr, nullptr, nullptr };
+        else {
+            return {
+                &type_tag<T>,
+                [](void* dst, const void* src) { ::new (dst) T(*static_cast<const T*>(src)); },
+                [](void* dst, void* src) { ::new (dst) T(std::move(*static_cast<T*>(src))); static_cast<T*>(src)->~T(); },
+                [](void* p) { static_cast<T*>(p)->~T(); }
+            };
+        }
+    }
+
+    // The address of the manager identifies the type.
+    template<typename T> static constexpr manager manager_for = make_manager<T>();
+
+    template<typename T> T* object() {
+        if constexpr (fits<T>)
+            return std::launder(reinterpret_cast<T*>(m_storage));
+        else
+            return *std::launder(reinterpret_cast<T**>(m_storage));
+    }
+    template<typename T> const T* object() const { return const_cast<small_any*>(this)->object<T>(); }
+
+    void copy_from(const small_any& src) {
+        if (src.m_manager == nullptr)
+            return;
+        if (src.m_manager->copy != nullptr)
+            src.m_manager->copy(m_storage, src.m_storage);
+        else
+            memcpy(m_storage, src.m_storage, CAPACITY);
+        m_manager = src.m_manager;
+    }
+
+    // Leaves src empty.
+    void move_from(small_any& src) {
+        if (src.m_manager == nullptr)
+            return;
+        if (src.m_manager->move != nullptr)
+            src.m_manager->move(m_storage, src.m_storage);
+        else
+            memcpy(m_storage, src.m_storage, CAPACITY);
+        m_manager = src.m_manager;
+        src.m_manager = nullptr;
+    }
+
+    const manager* m_manager = nullptr;
+    alignas(max_align_t) unsigned char m_storage[CAPACITY];
+};
+
+
 // Marker type to indicate that default_for was called.
-template<value_name_tag Name, typename T> struct default_for_value : public named_value<Name, T> {
+template<const auto& Name, typename T> struct default_for_value : public named_value<Name, T> {
 };
 
 // A value_name object is what you use as the parameter name at a call site. It is also used to specify which named parameters a function accepts, and their types.
 // Its operator= and operator() allow specifying named parameter with name = value or name(value) syntax.
 template<value_name_tag Name> class value_name {
 public:
-    static constexpr value_name_tag name = Name;
+    // The object the named_values of this name refer to, see value_name_tag.
+    static constexpr const auto& name = detail::name_object<Name>();
+
+    // The named_value of this name holding a T. Inside value_name name is not a constant yet, so the name object is given as is.
+    template<typename T> using named_type = named_value<detail::name_object<Name>(), T>;
 
     // no copying allowed.
     value_name() = default;
@@ -113,40 +465,56 @@ public:
     // These operators are the main feature of a value_name, allowing it to act as a named parameter. Note that the value is only
     // stored as a reference even if it comes in as a rvalue, which means that the named_value is only valid until the function
     // being called returns.
-    template<typename T> auto operator=(T&& value) const { return named_value<Name, array_to_pointer_t<decltype(std::forward<T>(value))>>(std::forward<T>(value)); }
-    template<typename T> auto operator()(T&& value) const { return named_value<Name, array_to_pointer_t<decltype(std::forward<T>(value))>>(std::forward<T>(value)); }
-    template<typename T, typename... Ts> auto operator()(T&& value, Ts&&... values) const {  // One regular parameter to exclude the empty parenthesis case.
+    template<typename T> constexpr auto operator=(T&& value) const { return named_type<array_to_pointer_t<decltype(std::forward<T>(value))>>(std::forward<T>(value)); }
+    template<typename T> constexpr auto operator()(T&& value) const { return named_type<array_to_pointer_t<decltype(std::forward<T>(value))>>(std::forward<T>(value)); }
+    template<typename T, typename... Ts> constexpr auto operator()(T&& value, Ts&&... values) const {  // One regular parameter to exclude the empty parenthesis case.
         using RET = tuple<decltype(forward<T>(value)), array_to_pointer_t<decltype(std::forward<Ts>(value))>...>;
-        return named_value<Name, RET>(RET{ forward<T>(value), forward<Ts>(values)... });
+        return named_type<RET>(RET{ forward<T>(value), forward<Ts>(values)... });
     }
 
     // As value_name:s are found by the predicates and the get overload which takes a value_name does a ::value on the found
     // element having a bool value here ensures that just mentioning a value_name works the same as value=true.
     static constexpr bool value = true;
 
+    // Emplaced values are constructed from args where they are finally stored, for instance as defaults in a parameter_binder.
+    // This allows parameter types which can't be moved. Like other named_values the result refers to args.
+    template<typename T, typename... Ts> constexpr auto emplace(Ts&&... args) const {
+        auto construction = detail::construct_in_place<T>([&args...] { return T(std::forward<Ts>(args)...); });
+        return named_type<decltype(construction)>(std::move(construction));
+    }
+
     // Bool false values can be generated by just naming !value_name.
-    named_value<Name, bool> operator!() const { return named_value<Name, bool>(false); }
+    constexpr named_type<bool> operator!() const { return named_type<bool>(false); }
 
     // The following methods are used in bind_parameters to indicate different requirements on named arguments matched.
 
     // Optional values are useful for _parameters_ to allow the function to see whether the named argument was present or not.
-    template<typename T> named_value<Name, std::optional<T>> optional() const { return named_value<Name, std::optional<T>>(nullopt); }
+    template<typename T> constexpr named_type<std::optional<T>> optional() const { return named_type<std::optional<T>>(nullopt); }
 
     // Variant values are used when you want to accept different types for a value_name, for instance a size as a Size object or
     // two ints. The version without default parameter automatically adds a std::monostate as the first option which is maybe
     // more convenient than wrapping the std::variant in a std::optional.
-    template<typename... Ts, typename T> named_value<Name, std::variant<Ts...>> variant(T&& defval) const { return named_value<Name, std::variant<Ts...>>(std::forward<T>(defval)); }
-    template<typename... Ts> named_value<Name, std::variant<monostate, Ts...>> variant() const { return named_value<Name, std::variant<monostate, Ts...>>(); }
+    template<typename... Ts, typename T> constexpr named_type<std::variant<Ts...>> variant(T&& defval) const { return named_type<std::variant<Ts...>>(std::forward<T>(defval)); }
+    template<typename... Ts> constexpr named_type<std::variant<monostate, Ts...>> variant() const { return named_type<std::variant<monostate, Ts...>>(); }
 
     // Any values are allowed to hold any data type in its std::any. If no default value is given it defaults to the empty state.
-    template<typename T> named_value<Name, std::any> any(T&& value) const { return named_value<Name, std::any>(std::forward<T>(value)); }
-    named_value<Name, std::any> any() const { return named_value<Name, std::any>(std::any()); }
+    template<typename T> named_type<std::any> any(T&& value) const { return named_type<std::any>(std::forward<T>(value)); }
+    named_type<std::any> any() const { return named_type<std::any>(std::any()); }
+
+    // small_any values work like any values but never allocate, unless ALLOW_HEAP is set. Values which don't fit in CAPACITY bytes
+    // are a compile error.
+    template<size_t CAPACITY = 3 * sizeof(void*), bool ALLOW_HEAP = false, typename T> named_type<std::small_any<CAPACITY, ALLOW_HEAP>> small_any(T&& value) const {
+        return named_type<std::small_any<CAPACITY, ALLOW_HEAP>>(std::forward<T>(value));
+    }
+    template<size_t CAPACITY = 3 * sizeof(void*), bool ALLOW_HEAP = false> named_type<std::small_any<CAPACITY, ALLOW_HEAP>> small_any() const {
+        return named_type<std::small_any<CAPACITY, ALLOW_HEAP>>(std::small_any<CAPACITY, ALLOW_HEAP>());
+    }
 
     // default_for values are used as parameters to indicate that if a actual of type T is present (after any defaulted unnamed
     // parameters have been consumed) a named_value for this name should be produced. Note that is_construtcible is used but no
     // complete overload resolution so don't use too many of these in one function.
-    template<typename T> default_for_value<Name, T> default_for(T&& defval) { return default_for_value<Name, T>(std::forward<T>(defval)); }
-    template<typename T> default_for_value<Name, std::optional<T>> default_for() { return default_for_value<Name, std::optional<T>>(std::optional<T>()); }
+    template<typename T> default_for_value<detail::name_object<Name>(), T> default_for(T&& defval) { return default_for_value<detail::name_object<Name>(), T>(std::forward<T>(defval)); }
+    template<typename T> default_for_value<detail::name_object<Name>(), std::optional<T>> default_for() { return default_for_value<detail::name_object<Name>(), std::optional<T>>(std::optional<T>()); }
 };
 
 
@@ -155,7 +523,7 @@ public:
 // Predicate to check if a type is a named_value instance. struct and variable versions both public as we still need the struct
 // version when used as PRED in tuple support functions.
 template<typename T> struct is_named : public false_type {};
-template<value_name_tag Name, typename D> struct is_named<named_value<Name, D>> : public true_type {};
+template<const auto& Name, typename D> struct is_named<named_value<Name, D>> : public true_type {};
 template<typename T> constexpr bool is_named_v = is_named<remove_reference_t<T>>::value;
 
 namespace detail {
@@ -165,7 +533,7 @@ namespace detail {
     };
 
     template<value_name_tag Name> struct named_type_for<value_name<Name>> {
-        using type = named_value<Name, bool>;
+        using type = named_value<value_name<Name>::name, bool>;
     };
 
     template<typename T> using named_type_for_t = typename named_type_for<decay_t<T>>::type;
@@ -212,10 +580,10 @@ namespace detail {
         
             
     // Helper to actually construct a T from P, whether it is a tuple or not.
-    template<typename T, typename P> decltype(auto) construct_from_elements(P&& par) {
-        if constexpr (is_same_v<remove_reference<T>, remove_reference<P>>)
+    template<typename T, typename P> constexpr decltype(auto) construct_from_elements(P&& par) {
+        if constexpr (is_same_v<decay_t<T>, decay_t<P>>)
             return forward<P>(par); // Return the incoming reference if the decayed type exactly matches.
-        else if constexpr (is_tuple_like_v<P>)
+        else if constexpr (is_tuple_like_v<decay_t<P>>)
             return make_from_tuple<decay_t<T>>(std::forward<P>(par));       // Return an object constructed from the par tuple
         else
             return decay_t<T>(std::forward<P>(par));                        // Return an object constructed by conversion.
@@ -224,8 +592,8 @@ namespace detail {
 
 // value_name:s return true as they are converted to named_value<Name, bool> later.
 template<value_name_tag Name, typename T> struct has_same_name : false_type {};
-template<value_name_tag Name, value_name_tag Name2, typename D> struct has_same_name<Name, named_value<Name2, D>> : std::integral_constant<bool, &Name == &Name2> {};
-template<value_name_tag Name, value_name_tag Name2> struct has_same_name<Name, value_name<Name2>> : std::integral_constant<bool, &Name == &Name2> {};
+template<value_name_tag Name, const auto& Name2, typename D> struct has_same_name<Name, named_value<Name2, D>> : std::integral_constant<bool, Name == Name2> {};
+template<value_name_tag Name, value_name_tag Name2> struct has_same_name<Name, value_name<Name2>> : std::integral_constant<bool, Name == Name2> {};
 
 // Predicate that can be used with the tuple support functions to find a matching named_value or value_name.
 template<value_name_tag N> struct is_named_as {
@@ -247,31 +615,67 @@ template<value_name_tag N> struct is_named_as {
 // };
 // 
 
+namespace detail {
+    // The name of a named_value or value_name, an empty value_name_tag for other types. This is specialized as a class template
+    // as gcc doesn't find partial specializations of variable templates when named.h is imported as a module.
+    template<typename T> struct name_identity_of {
+        static constexpr value_name_tag value{};
+    };
+    template<const auto& Name, typename D> struct name_identity_of<named_value<Name, D>> {
+        static constexpr value_name_tag value = Name;
+    };
+    template<value_name_tag Name> struct name_identity_of<value_name<Name>> {
+        static constexpr value_name_tag value = Name;
+    };
+    template<const auto& Name, typename D> struct name_identity_of<default_for_value<Name, D>> {
+        static constexpr value_name_tag value = Name;
+    };
+    template<const auto& Name, typename T, typename A> struct name_identity_of<lazy_named_value<Name, T, A>> {
+        static constexpr value_name_tag value = Name;
+    };
+
+    template<typename T> constexpr value_name_tag name_identity = name_identity_of<T>::value;
+
+    // Table of the name identities of all elements of a tuple-like. This is instantiated once per tuple type, after which each
+    // lookup by name is a constexpr loop instead of one predicate instantiation per element and name.
+    template<typename TLC, size_t... IXs> constexpr array<value_name_tag, sizeof...(IXs)> tuple_names(index_sequence<IXs...>)
+    {
+        return { name_identity<decay_t<tuple_element_t<IXs, TLC>>>... };
+    }
+
+    template<typename TLC> constexpr auto tuple_names_v = tuple_names<TLC>(make_index_sequence<tuple_size_v<TLC>>());
+}
+
 // Overloads of the new tuple based functions with direct Name (and U) template parameter/s for convenience: 
-template<value_name_tag Name, typename TL> constexpr size_t tuple_count_if() { return tuple_count_if<is_named_as<Name>::template tpl, TL>(); }
-template<value_name_tag Name, typename TL> constexpr bool tuple_contains() { return tuple_contains<is_named_as<Name>::template tpl, TL>(); }
+template<value_name_tag Name, typename TL> constexpr size_t tuple_count_if() { return detail::count_equal(detail::tuple_names_v<decay_t<TL>>, Name, 0); }
+template<value_name_tag Name, typename TL> constexpr bool tuple_contains() { return tuple_count_if<Name, TL>() > 0; }
 
-template<value_name_tag Name, typename TL> constexpr size_t tuple_find() { return tuple_find<is_named_as<Name>::template tpl, TL>(); }
-template<value_name_tag Name, size_t POS, typename TL> constexpr size_t tuple_find() { return tuple_find<is_named_as<Name>::template tpl, POS, TL>(); }
+template<value_name_tag Name, size_t POS, typename TL> constexpr size_t tuple_find() { return detail::find_nth_equal(detail::tuple_names_v<decay_t<TL>>, Name, 0, POS); }
+template<value_name_tag Name, typename TL> constexpr size_t tuple_find() { return tuple_find<Name, 0, TL>(); }
 
-template<value_name_tag Name, size_t N, typename TL> constexpr size_t tuple_find_nth() { return tuple_find_nth<is_named_as<Name>::template tpl, N, TL>(); }
+template<value_name_tag Name, size_t N, typename TL> constexpr size_t tuple_find_nth() { return detail::find_nth_equal(detail::tuple_names_v<decay_t<TL>>, Name, N, 0); }
 
 // Note: This assumes a named_value or value_name of the correct name (as specified by the incoming ValueName) can be found.
-template<auto&& ValueName, typename TL> decltype(auto) get(TL&& t)
+template<const auto& ValueName, typename TL> constexpr decltype(auto) get(TL&& t)
 {
     constexpr size_t IX = tuple_find<decay_t<decltype(ValueName)>::name, TL>();
     static_assert(IX != npos, "Name not found");
-    using ET = remove_reference_t<tuple_element_t<IX, decay_t<TL>>>;
-    if constexpr (is_const_v<ET>)
-        return forward<const typename ET::type>(get<IX>(forward<TL>(t)).value);
+    // Reference values are returned as declared, so that arguments are forwarded as given. By value values get the value category
+    // and constness of the tuple, as for std::get.
+    using ET = remove_cvref_t<tuple_element_t<IX, decay_t<TL>>>;
+    using T = typename ET::type;
+    if constexpr (detail::is_lazy_named_v<ET>)
+        return get<IX>(forward<TL>(t)).get();
+    else if constexpr (is_reference_v<T>)
+        return forward<T>(get<IX>(forward<TL>(t)).value);
     else
-        return forward<typename ET::type>(get<IX>(forward<TL>(t)).value);
+        return (get<IX>(forward<TL>(t)).value);
 }
 
 
 // Note: This always returns a D even if an existing value requires conversion. Emplacement construction occurs if the value found
 // is a tuple-like.
-template<value_name_tag Name, typename D, typename TL> decltype(auto) get_or(D&& defval, TL&& t)
+template<value_name_tag Name, typename D, typename TL> constexpr decltype(auto) get_or(D&& defval, TL&& t)
 {
     constexpr size_t IX = tuple_find<Name, TL>();
     if constexpr (IX == npos)
@@ -286,11 +690,11 @@ template<value_name_tag Name, typename D, typename TL> decltype(auto) get_or(D&&
 // defVal (with its value category preserved regardless of the fact that the named_value itself is typically a rvalue.
 // %% Maybe only the rvalue overload should exist not to encourage creating named_value objects containing constants and _then_
 // passing them to get_or, as those constants would then be expired.
-template<value_name_tag Name, typename D, typename TL> decltype(auto) get_or(const named_value<Name, D>& defval, TL&& t)
+template<const auto& Name, typename D, typename TL> constexpr decltype(auto) get_or(const named_value<Name, D>& defval, TL&& t)
 {
     return get_or<Name, D>(std::forward<D>(defval.value), std::forward<TL>(t));
 }
-template<value_name_tag Name, typename D, typename TL> decltype(auto) get_or(named_value<Name, D>&& defval, TL&& t)
+template<const auto& Name, typename D, typename TL> constexpr decltype(auto) get_or(named_value<Name, D>&& defval, TL&& t)
 {
     return get_or<Name, D>(forward<D>(defval.value), forward<TL>(t));
 }
@@ -298,69 +702,849 @@ template<value_name_tag Name, typename D, typename TL> decltype(auto) get_or(nam
 
 
 namespace detail {
-    // Sentinel used when all the Ps are handled, just check that args is empty and then return res
-    template<typename A, typename R> auto bind_named_parameters(A&& args, R res) {
-            static_assert(tuple_size_v<decay_t<A>> == 0, "Some named arguments were not accepted. See signature of the failing instance to see which");
-            return res;     // This is always a return by value.
+    // The type a parameter_binder stores a parameter as. named_values returned by value_name::operator= refer to their value, which
+    // is typically a temporary, so the binder keeps a copy instead.
+    template<typename T> struct owned_parameter {
+        using type = T;
+    };
+    template<const auto& Name, typename T> struct owned_parameter<named_value<Name, T>> {
+        using type = named_value<Name, remove_cvref_t<T>>;
+    };
+    template<const auto& Name, typename T, typename F> struct owned_parameter<named_value<Name, in_place_construction<T, F>>> {
+        using type = named_value<Name, T>;
+    };
+
+    template<typename P> using owned_parameter_t = typename owned_parameter<decay_t<P>>::type;
+
+    template<typename P> constexpr decltype(auto) owned_parameter_value(P&& p)
+    {
+        if constexpr (is_named_v<decay_t<P>>)
+            return forward<typename decay_t<P>::type>(p.value);
+        else
+            return forward<P>(p);
+    }
+
+    // How matched arguments are bound: converted to the parameter type, converted to the variant alternative they select,
+    // kept unconverted until accessed, or copied or moved into a result which doesn't refer to arguments or defaults.
+    enum class bind_mode {
+        convert,
+        static_alternative,
+        lazy,
+        owned
+    };
+
+    // For each parameter the index of the argument it binds to, or npos if it keeps its default. If several parameters have the
+    // same name they bind to consecutive arguments of that name.
+    template<typename AC, typename... PCs> constexpr array<size_t, sizeof...(PCs)> make_bind_plan()
+    {
+        constexpr auto arg_names = tuple_names_v<AC>;
+        constexpr auto par_names = tuple_names_v<type_list<PCs...>>;
+        array<size_t, sizeof...(PCs)> ret{};
+        for (size_t p = 0; p < sizeof...(PCs); p++) {
+            size_t n = 0;
+            for (size_t q = 0; q < p; q++) {
+                if (par_names[q] == par_names[p])
+                    n++;
+            }
+            ret[p] = find_nth_equal(arg_names, par_names[p], n, 0);
+        }
+
+        return ret;
     }
 
-    // Match any element in the tuple-like args by name to p and append the result (hit or miss) to res, while removing the
-    // matching element from args, if found.
-    template<typename A, typename R, typename P, typename... Ps> auto bind_named_parameters(A&& args, R&& res, P&& p, Ps&&... ps) {
+    template<size_t N, size_t M> constexpr bool binds_all_arguments(const array<size_t, M>& plan)
+    {
+        for (size_t a = 0; a < N; a++) {
+            if (find_nth_equal(plan, a, 0, 0) == npos)
+                return false;
+        }
+
+        return true;
+    }
+
+    // The value of a named argument. A value_name argument means true.
+    template<size_t IX, typename A> constexpr decltype(auto) argument_value(A& args)
+    {
+        using E = decay_t<tuple_element_t<IX, decay_t<A>>>;
+        if constexpr (is_named_v<E>)
+            return forward<typename E::type>(get<IX>(args).value);
+        else
+            return bool(E::value);
+    }
+
+    template<typename T> struct is_variant : public false_type {};
+    template<typename... Ts> struct is_variant<variant<Ts...>> : public true_type {};
+    template<typename T> constexpr bool is_variant_v = is_variant<T>::value;
+
+    // Overload set used to select the variant alternative for an A the same way as the converting constructor of variant does:
+    // An alternative T is only a candidate if T x[] = { a } is valid, which excludes narrowing conversions, including pointers to
+    // bool.
+    template<typename T> struct single_element_array {
+        T elements[1];
+    };
+    template<typename T, typename A> concept initializes_without_narrowing = requires(A&& a) { single_element_array<T>{ { forward<A>(a) } }; };
+
+    template<typename T, typename A> struct variant_overload {
+        type_identity<T> operator()(T) const requires initializes_without_narrowing<T, A>;
+    };
+    template<typename V, typename A> struct variant_overloads;
+    template<typename... Ts, typename A> struct variant_overloads<variant<Ts...>, A> : variant_overload<Ts, A>... {
+        using variant_overload<Ts, A>::operator()...;
+    };
+
+    // The type to bind a parameter of type T as when the argument is an A: If T is a variant the alternative A selects, unless
+    // A is itself a variant, a tuple-like or does not select any alternative.
+    template<typename T, typename A> auto static_alternative()
+    {
+        if constexpr (!is_variant_v<T> || is_variant_v<decay_t<A>> || is_tuple_like_v<decay_t<A>>)
+            return type_identity<T>();
+        else if constexpr (is_invocable_v<variant_overloads<T, A>, A>)
+            return invoke_result_t<variant_overloads<T, A>, A>();
+        else
+            return type_identity<T>();
+    }
+
+    template<typename T, typename A> using static_alternative_t = typename decltype(static_alternative<T, A>())::type;
+
+    // The type of a bound parameter. Defaults given as lvalues are bound as references to them and defaults given as rvalues
+    // are bound by value, as they would otherwise refer to temporaries which are gone once the result is used. Matched
+    // arguments are converted to the parameter type, preserving the named_value wrapper. In static_alternative mode variant
+    // parameters are instead converted to the alternative selected by the argument type, and in lazy mode arguments which need
+    // a conversion are kept as they are until accessed. In owned mode all parameters are bound by value.
+    // An argument is bound lazily if it refers to a value which would be converted to a by value parameter of another type.
+    template<typename T, typename AT, typename C> constexpr bool converts_lazily = is_reference_v<AT> && is_same_v<typename C::type, T> && !is_same_v<decay_t<AT>, T>;
+
+    template<size_t IX, typename A, typename P, bind_mode MODE> struct bound_type {
         using PC = decay_t<P>;
-        constexpr size_t IX = tuple_find<PC::name, A>();
-        if constexpr (IX != npos) {  // found a value of the correct name. Try to construct the correct P::type from it, preserving the named_value wrapper.
-            auto v = make_named_from_tuple<PC::name, decay_t<typename PC::type>>(forward<typename decay_t<tuple_element_t<IX, decay_t<A>>>::type>(get<IX>(args).value));
-            return bind_named_parameters(tuple_erase<IX>(forward<A>(args)), tuple_concat(res, move(v)), forward<Ps>(ps)...);
+        using AT = decltype(argument_value<IX>(declval<A&>()));
+        using T = conditional_t<MODE == bind_mode::static_alternative, static_alternative_t<decay_t<typename PC::type>, AT>, decay_t<typename PC::type>>;
+        using converted = decltype(make_named_from_tuple<PC::name, T>(declval<AT>()));
+        using type = conditional_t<MODE == bind_mode::owned, named_value<PC::name, T>,
+                     conditional_t<MODE == bind_mode::lazy && converts_lazily<T, AT, converted>, lazy_named_value<PC::name, T, AT>, converted>>;
+    };
+    template<typename A, typename P, bind_mode MODE> struct bound_type<npos, A, P, MODE> {
+        using type = conditional_t<is_lvalue_reference_v<P> && MODE != bind_mode::owned, P, owned_parameter_t<P>>;
+    };
+
+    // What to construct a bound parameter from. Arguments of the parameter type, and tuple-likes of the parameter type, are
+    // passed on so that the parameter is constructed directly from them inside the result tuple. Other arguments are passed as a
+    // deferred construction, converting with static_cast or from the elements of a tuple-like, so that no temporary parameter
+    // value is moved into the result.
+    template<size_t IX, typename R, typename A, typename P> constexpr decltype(auto) bound_value(A& args, P&& p)
+    {
+        if constexpr (is_lazy_named_v<R>)
+            return argument_value<IX>(args);
+        else if constexpr (IX == npos && is_lvalue_reference_v<P> && is_reference_v<R>)
+            return forward<P>(p);
+        else if constexpr (IX == npos && is_lvalue_reference_v<P>)
+            return static_cast<const remove_reference_t<typename decay_t<P>::type>&>(p.value);      // Copy of an owned default.
+        else if constexpr (IX == npos)
+            return owned_parameter_value(forward<P>(p));
+        else if constexpr (is_tuple_like_v<decay_t<decltype(argument_value<IX>(args))>> && !binds_by_reference<typename decay_t<P>::type, decltype(argument_value<IX>(args))>)
+            return construct_in_place<typename R::type>([&] { return make_from_tuple<typename R::type>(argument_value<IX>(args)); });
+        else if constexpr (is_reference_v<decltype(argument_value<IX>(args))> && !is_reference_v<typename R::type>)
+            return converted_in_place<typename R::type>(argument_value<IX>(args));
+        else
+            return argument_value<IX>(args);
+    }
+
+    // The mapping from parameters to arguments is computed up front so that the result is constructed in one go, with each
+    // element constructed from its argument or default exactly once.
+    // Note: default_for_value parameters are not yet matched against unnamed arguments which are constructible to their type.
+    template<bind_mode MODE, template<typename...> class RESULT, typename A, size_t... PIXs, typename... Ps> constexpr auto bind_planned_parameters(A&& args, index_sequence<PIXs...>, Ps&&... ps)
+    {
+        constexpr auto plan = make_bind_plan<decay_t<A>, decay_t<Ps>...>();
+        static_assert(binds_all_arguments<tuple_size_v<decay_t<A>>>(plan), "Some named arguments were not accepted. See signature of the failing instance to see which");
+        return RESULT<typename bound_type<plan[PIXs], A, Ps, MODE>::type...>{ bound_value<plan[PIXs], typename bound_type<plan[PIXs], A, Ps, MODE>::type>(args, forward<Ps>(ps))... };
+    }
+
+    // Arguments are sorted by name before the bind plan is made, so that call sites giving the same arguments in different
+    // orders share the instantiation of bind_planned_parameters and everything below it. Only arguments named by string
+    // literals can be ordered at compile time, so if any argument is unnamed or named by a const char* variable the order is
+    // kept. The sort is stable, which keeps arguments with the same name in order.
+    template<size_t N> constexpr bool literal_names(const array<value_name_tag, N>& names)
+    {
+        for (auto& name : names) {
+            if (name.tag != nullptr || name.view().empty())
+                return false;
         }
-        else {
-            // If P is a default_for_value we also check for a constructible from condition from any of the unnamed values in args.
-            // Note that this is a special constructible from which takes into account tuples in args where the type in P is
-            // constructible from the tuple elements.
-            //using T = decay_t<typename PC::type>;
-            //size_t DIX = tuple_find<predicate_and<predicate_not<is_named>::template tpl, predicate_bind1st<detail::is_constructible_from_elements, T>::template tpl>::template tpl, A>();
-            //if (DIX != npos) {
-            //    auto v = make_named<PC::name, T>(forward<tuple_element_t<IX, A>>(get<IX>(args)));
-            //    return bind_named_parameters(forward<A>(args), tuple_concat(res, move(v)), forward<Ps>(ps)...);
-            //}
-            //else  // Not found, append default value to res and continue.
-                return bind_named_parameters(forward<A>(args), tuple_concat(res, forward<P>(p)), forward<Ps>(ps)...);
+
+        return true;
+    }
+
+    template<size_t N> constexpr array<size_t, N> make_canonical_order(const array<value_name_tag, N>& names)
+    {
+        array<size_t, N> ret{};
+        for (size_t ix = 0; ix < N; ix++)
+            ret[ix] = ix;
+        if (!literal_names(names))
+            return ret;
+
+        for (size_t ix = 1; ix < N; ix++) {         // Insertion sort, argument lists are short.
+            for (size_t jx = ix; jx > 0 && names[ret[jx]].view() < names[ret[jx - 1]].view(); jx--)
+                swap(ret[jx], ret[jx - 1]);
         }
+
+        return ret;
+    }
+
+    template<size_t N> constexpr bool is_identity_order(const array<size_t, N>& order)
+    {
+        for (size_t ix = 0; ix < N; ix++) {
+            if (order[ix] != ix)
+                return false;
+        }
+
+        return true;
+    }
+
+    template<typename AC> struct canonical_order {
+        static constexpr auto value = make_canonical_order(tuple_names_v<AC>);
+    };
+
+    template<typename A, size_t... IXs> constexpr auto canonical_arguments(A&& args, index_sequence<IXs...>)
+    {
+        using order = canonical_order<decay_t<A>>;
+        return tuple<decltype(get<order::value[IXs]>(forward<A>(args)))...>(get<order::value[IXs]>(forward<A>(args))...);
+    }
+
+    template<bind_mode MODE, template<typename...> class RESULT, typename A, size_t... PIXs, typename... Ps> constexpr auto bind_named_parameters(A&& args, index_sequence<PIXs...>, Ps&&... ps)
+    {
+        using order = canonical_order<decay_t<A>>;
+        if constexpr (is_identity_order(order::value))
+            return bind_planned_parameters<MODE, RESULT>(forward<A>(args), index_sequence<PIXs...>(), forward<Ps>(ps)...);
+        else
+            return bind_planned_parameters<MODE, RESULT>(canonical_arguments(forward<A>(args), make_index_sequence<order::value.size()>()), index_sequence<PIXs...>(), forward<Ps>(ps)...);
     }
 }
 
 // bind_parameters takes actuals as a tuple as the first parameter and then a list of allowed parameters as the rest of the
 // parameters. It matches these together and returns a tuple ordered according to the parameters, with any matching values replaced.
-template<typename A, typename... Ps> auto bind_parameters(A&& args, Ps&&... ps)
+template<typename A, typename... Ps> constexpr auto bind_parameters(A&& args, Ps&&... ps)
+{
+        return detail::bind_named_parameters<detail::bind_mode::convert, tuple>(forward<A>(args), index_sequence_for<Ps...>(), forward<Ps>(ps)...);
+}
+
+// Bind into another tuple-like than tuple, such as packed_tuple, which takes less space for parameters of mixed alignment if the
+// result is stored.
+template<template<typename...> class RESULT, typename A, typename... Ps> constexpr auto bind_parameters(A&& args, Ps&&... ps)
+{
+        return detail::bind_named_parameters<detail::bind_mode::convert, RESULT>(forward<A>(args), index_sequence_for<Ps...>(), forward<Ps>(ps)...);
+}
+
+// bind_static_parameters works as bind_parameters except that a variant parameter is bound as the alternative selected by the
+// type of its argument, so the function body doesn't have to check which alternative it got. Parameters which keep their default,
+// and arguments which are themselves variants, are still bound as variants. Use visit<name>(f, bound) to handle both cases,
+// each instantiation of the function gets a body specialized for its argument types.
+template<typename A, typename... Ps> constexpr auto bind_static_parameters(A&& args, Ps&&... ps)
+{
+        return detail::bind_named_parameters<detail::bind_mode::static_alternative, tuple>(forward<A>(args), index_sequence_for<Ps...>(), forward<Ps>(ps)...);
+}
+
+// bind_lazy_parameters works as bind_parameters except that arguments which need a conversion to their parameter type are bound
+// as lazy_named_values, which convert on the first get<name>. This avoids conversions of arguments that a function doesn't use,
+// for instance as it returns early. The result refers to the arguments and can't be copied.
+template<typename A, typename... Ps> constexpr auto bind_lazy_parameters(A&& args, Ps&&... ps)
+{
+        return detail::bind_named_parameters<detail::bind_mode::lazy, tuple>(forward<A>(args), index_sequence_for<Ps...>(), forward<Ps>(ps)...);
+}
+
+// bind_owned_parameters works as bind_parameters except that all parameters are bound by value, so the result doesn't refer to
+// the arguments or the defaults and can outlive the call, for instance in a task run by a thread pool or in a coroutine frame.
+// Arguments given as rvalues are moved once, from the argument directly into the result, while arguments given as lvalues and
+// defaults are copied. Construct the storage of the task from the returned prvalue, for instance as a lambda init-capture, so that
+// copy elision avoids further moves.
+template<typename A, typename... Ps> constexpr auto bind_owned_parameters(A&& args, Ps&&... ps)
+{
+        return detail::bind_named_parameters<detail::bind_mode::owned, tuple>(forward<A>(args), index_sequence_for<Ps...>(), forward<Ps>(ps)...);
+}
+
+// Call f with the value of the element named as ValueName, or if that is a variant with its current alternative using std::visit.
+template<const auto& ValueName, typename F, typename TL> constexpr decltype(auto) visit(F&& f, TL&& t)
 {
-        return detail::bind_named_parameters(forward<A>(args), tuple<>(), forward<Ps>(ps)...);
+    decltype(auto) value = get<ValueName>(forward<TL>(t));
+    if constexpr (detail::is_variant_v<remove_cvref_t<decltype(value)>>)
+        return std::visit(forward<F>(f), forward<decltype(value)>(value));
+    else
+        return forward<F>(f)(forward<decltype(value)>(value));
 }
 
 
 namespace detail {
-    template<size_t IX, typename A, typename... Ps, typename... Vs> auto call_bind_parameters(A&& args, const tuple<Ps...>& ps, const Vs&... vs)
+    template<bind_mode MODE, template<typename...> class RESULT, typename A, typename T, size_t... IXs> constexpr auto call_bind_parameters(A&& args, T&& ps, index_sequence<IXs...>)
     {
-        if constexpr (IX == sizeof...(Ps))
-            return bind_parameters(std::forward<A>(args), vs...);
-        else
-            return call_bind_parameters<IX + 1>(std::forward<A>(args), ps, vs..., get<IX>(ps));
+        return bind_named_parameters<MODE, RESULT>(std::forward<A>(args), index_sequence<IXs...>(), get<IXs>(std::forward<T>(ps))...);
+    }
+}
+
+
+// Errors reported by parameter_binder::bind_keys.
+enum class bind_key_error {
+    unknown_key,        // No parameter has this name.
+    wrong_type          // The parameter type can't be constructed from the value.
+};
+
+namespace detail {
+    constexpr uint64_t name_hash(string_view name, uint64_t seed)
+    {
+        uint64_t h = 14695981039346656037ull ^ seed;        // FNV-1a
+        for (char c : name) {
+            h ^= uint8_t(c);
+            h *= 1099511628211ull;
+        }
+        return h ^ (h >> 29);
+    }
+
+    struct name_hash_params {
+        uint64_t seed;
+        size_t size;        // Power of two, 0 if no perfect hash was found.
+    };
+
+    // Find a seed and a table size for which name_hash maps all names to different slots.
+    template<size_t N> constexpr name_hash_params find_name_hash(const array<value_name_tag, N>& names)
+    {
+        size_t size = 1;
+        while (size < N)
+            size *= 2;
+
+        for (size_t tries = 0; tries < 8; tries++, size *= 2) {
+            for (uint64_t seed = 0; seed < 256; seed++) {
+                array<size_t, N> slots{};
+                for (size_t ix = 0; ix < N; ix++)
+                    slots[ix] = name_hash(names[ix].view(), seed) & (size - 1);
+
+                bool collision = false;
+                for (size_t ix = 0; ix < N && !collision; ix++) {
+                    for (size_t jx = ix + 1; jx < N && !collision; jx++)
+                        collision = slots[ix] == slots[jx];
+                }
+                if (!collision)
+                    return { seed, size };
+            }
+        }
+
+        return { 0, 0 };
+    }
+
+    template<size_t N> constexpr bool literal_and_unique(const array<value_name_tag, N>& names)
+    {
+        for (size_t ix = 0; ix < N; ix++) {
+            if (names[ix].tag != nullptr || names[ix].view().empty())
+                return false;
+            for (size_t jx = ix + 1; jx < N; jx++) {
+                if (names[ix] == names[jx])
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<size_t SIZE, size_t N> constexpr array<size_t, SIZE> name_hash_slots(const array<value_name_tag, N>& names, uint64_t seed)
+    {
+        array<size_t, SIZE> ret{};
+        for (auto& slot : ret)
+            slot = npos;
+        for (size_t ix = 0; ix < N; ix++)
+            ret[name_hash(names[ix].view(), seed) & (SIZE - 1)] = ix;
+
+        return ret;
+    }
+
+    // Perfect hash table from the names of the parameters to their indices, computed at compile time.
+    template<typename... Pars> struct name_hash_table {
+        static constexpr auto names = tuple_names_v<type_list<Pars...>>;
+        static_assert(literal_and_unique(names), "bind_keys requires unique names given as string literals");
+
+        static constexpr name_hash_params params = find_name_hash(names);
+        static_assert(params.size != 0, "No perfect hash found for the parameter names");
+
+        static constexpr auto slots = name_hash_slots<params.size>(names, params.seed);
+
+        // Returns the index of the parameter called key, or npos.
+        static size_t find(string_view key)
+        {
+            size_t ix = slots[name_hash(key, params.seed) & (params.size - 1)];
+            if (ix != npos && names[ix].view() == key)
+                return ix;
+            return npos;
+        }
+    };
+
+    // The parameter with index IX of a bind_keys result, constructed in place from the value of its key if one was given, else
+    // copied from the default.
+    template<size_t IX, typename T, typename V> constexpr auto key_value_or_default(const T& defaults, const V* value)
+    {
+        using PT = typename tuple_element_t<IX, T>::type;
+        return construct_in_place<PT>([&defaults, value] {
+            if constexpr (is_constructible_v<PT, const V&>) {
+                if (value != nullptr)
+                    return PT(*value);
+            }
+            return PT(get<IX>(defaults).value);
+        });
+    }
+
+    template<typename RESULT, typename T, typename V, size_t... IXs> constexpr RESULT bind_key_values(const T& defaults, const array<const V*, sizeof...(IXs)>& values, index_sequence<IXs...>)
+    {
+        return RESULT(key_value_or_default<IXs>(defaults, values[IXs])...);
     }
 }
 
 
 // It is probably more convenient to have an object containing the default values and then just call a bind method with the
 // arguments. This could be a wrapper:
-template<typename... Pars> class parameter_binder {
+namespace detail {
+    // The element type of a column of a batch. bool is stored as unsigned char as vector<bool> is not contiguous.
+    template<typename T> using batch_element_t = conditional_t<is_same_v<T, bool>, unsigned char, T>;
+
+    // The value of parameter type T from the argument with index IX of an argument set. The set is not moved from as the
+    // caller keeps the batch.
+    template<typename T, size_t IX, typename S> T batch_value(const S& set)
+    {
+        using E = decay_t<tuple_element_t<IX, S>>;
+        if constexpr (!is_named_v<E>)
+            return T(E::value);
+        else if constexpr (is_tuple_like_v<decay_t<typename E::type>> && !binds_by_reference<T, typename E::type>)
+            return make_from_tuple<T>(get<IX>(set).value);
+        else
+            return T(get<IX>(set).value);
+    }
+
+    // One column of a batch, filled from the arguments with index AIX of each set, or with copies of the default if no argument
+    // binds to the parameter.
+    template<size_t AIX, typename R, typename P> auto batch_column(const R& sets, const P& par, size_t count)
+    {
+        using T = batch_element_t<decay_t<typename P::type>>;
+        named_value<P::name, vector<T>> ret;
+        if constexpr (AIX == npos)
+            ret.value.assign(count, T(par.value));
+        else {
+            ret.value.reserve(count);
+            for (const auto& set : sets)
+                ret.value.push_back(batch_value<T, AIX>(set));
+        }
+
+        return ret;
+    }
+
+    // All argument sets have the same type S so the parameters are matched to arguments once, after which each column is
+    // filled in a loop of its own.
+    template<typename S, typename R, typename... Pars, size_t... PIXs> auto bind_batch(const R& sets, const tuple<Pars...>& pars, index_sequence<PIXs...>)
+    {
+        constexpr auto plan = make_bind_plan<S, Pars...>();
+        static_assert(binds_all_arguments<tuple_size_v<S>>(plan), "Some named arguments were not accepted. See signature of the failing instance to see which");
+        size_t count = size_t(distance(begin(sets), end(sets)));
+        return tuple<decltype(batch_column<plan[PIXs]>(sets, get<PIXs>(pars), count))...>{ batch_column<plan[PIXs]>(sets, get<PIXs>(pars), count)... };
+    }
+}
+
+
+namespace detail {
+    // The type an override of a parameter of a binder with parameters PT is stored as: The type of that parameter, so that
+    // bind gives the same result type whichever layer a default comes from.
+    template<typename PT, typename P> constexpr size_t overridden_index()
+    {
+        constexpr size_t IX = tuple_find<decay_t<P>::name, PT>();
+        static_assert(IX != npos, "Only parameters of the base binder can be overridden");
+        return IX;
+    }
+
+    template<typename PT, typename P> using override_t = decay_t<tuple_element_t<overridden_index<PT, P>(), PT>>;
+
+    // An override P can be stored as the type of the parameter it overrides, see converted_in_place.
+    template<typename PT, typename P> concept converts_to_override = converts_without_narrowing<decltype(owned_parameter_value(declval<P>())), typename override_t<PT, P>::type>;
+}
+
+template<typename BASE, typename... Ovs> class layered_binder;
+
+
+//////////////// Instrumentation of parameter_binder ////////////////
+
+// The instrumentation policy of a basic_parameter_binder has a static on_bind<PT, AC>(binds) function which is called with the
+// parameter types and the decayed argument types on each bind, also through layered_binders derived from the binder, and once
+// with the number of argument sets by bind_many. bind_keys, where the given parameters are only known at runtime, instead calls
+// on_bind<PT>(supplied) with a flag per parameter. The policy of parameter_binder does nothing and compiles to nothing.
+struct no_bind_instrumentation {
+    template<typename PT, typename AC> static constexpr void on_bind(uint64_t = 1) {}
+    template<typename PT, size_t N> static constexpr void on_bind(const array<bool, N>&) {}
+};
+
+// A snapshot of the counters of one binding site.
+struct bind_site_statistics {
+    struct parameter {
+        string_view name;
+        uint64_t supplied = 0;          // Binds where the caller gave an argument for the parameter.
+        uint64_t defaulted = 0;         // Binds where the parameter got its default.
+    };
+
+    string_view site;
+    uint64_t binds = 0;
+    vector<parameter> parameters;
+};
+
+namespace detail {
+    // Each thread counts in a block of its own, aligned so that no two threads write to the same cache line. The counters are
+    // atomic only so that snapshots may read them while they are updated, increments are relaxed and never contended.
+    inline constexpr size_t bind_counter_alignment = 64;
+
+    template<size_t N> struct alignas(bind_counter_alignment) bind_thread_counters {
+        atomic<uint64_t> binds{ 0 };
+        array<atomic<uint64_t>, N> supplied{};
+        array<atomic<uint64_t>, N> defaulted{};
+    };
+
+    struct bind_site_base {
+        virtual bind_site_statistics snapshot() const = 0;
+    };
+
+    // The registry is a function local static so that translation units which don't use bind_counters get no static
+    // initialization code.
+    struct bind_site_registry {
+        mutex lock;
+        vector<const bind_site_base*> sites;
+    };
+
+    inline bind_site_registry& bind_sites()
+    {
+        static bind_site_registry registry;
+        return registry;
+    }
+
+    // The counters of all threads for one site and parameter list. Blocks of exited threads are kept so that their counts remain.
+    template<value_name_tag Site, typename PT> class bind_site final : public bind_site_base {
+        static constexpr size_t N = tuple_size_v<PT>;
+
+    public:
+        static bind_site& instance() {
+            static bind_site site;
+            return site;
+        }
+
+        bind_thread_counters<N>& thread_counters() {
+            thread_local bind_thread_counters<N>* counters = add_thread();
+            return *counters;
+        }
+
+        bind_site_statistics snapshot() const override {
+            static constexpr auto names = tuple_names_v<PT>;
+            bind_site_statistics ret;
+            ret.site = Site.view();
+            for (auto& name : names)
+                ret.parameters.push_back({ name.tag != nullptr ? string_view(*name.tag) : name.view() });
+
+            lock_guard lock(m_mutex);
+            for (auto& counters : m_threads) {
+                ret.binds += counters->binds.load(memory_order_relaxed);
+                for (size_t ix = 0; ix < N; ix++) {
+                    ret.parameters[ix].supplied += counters->supplied[ix].load(memory_order_relaxed);
+                    ret.parameters[ix].defaulted += counters->defaulted[ix].load(memory_order_relaxed);
+                }
+            }
+
+            return ret;
+        }
+
+    private:
+        bind_site() {
+            auto& registry = bind_sites();
+            lock_guard lock(registry.lock);
+            registry.sites.push_back(this);
+        }
+
+        bind_thread_counters<N>* add_thread() {
+            lock_guard lock(m_mutex);
+            m_threads.push_back(make_unique<bind_thread_counters<N>>());
+            return m_threads.back().get();
+        }
+
+        mutable mutex m_mutex;
+        vector<unique_ptr<bind_thread_counters<N>>> m_threads;
+    };
+}
+
+// Policy counting the binds of a binder, and for each of its parameters how often it was supplied by the caller and how often it
+// got its default. Site names the binder in the statistics, binders with the same Site and parameter types share counters.
+template<value_name_tag Site> struct bind_counters {
+    template<typename PT, typename AC> static void on_bind(uint64_t binds = 1) {
+        static constexpr auto plan = []<size_t... IXs>(index_sequence<IXs...>) {
+            return detail::make_bind_plan<AC, tuple_element_t<IXs, PT>...>();
+        }(make_index_sequence<tuple_size_v<PT>>());
+
+        auto& counters = detail::bind_site<Site, PT>::instance().thread_counters();
+        counters.binds.fetch_add(binds, memory_order_relaxed);
+        for (size_t ix = 0; ix < plan.size(); ix++)
+            (plan[ix] == npos ? counters.defaulted[ix] : counters.supplied[ix]).fetch_add(binds, memory_order_relaxed);
+    }
+    template<typename PT, size_t N> static void on_bind(const array<bool, N>& supplied) {
+        auto& counters = detail::bind_site<Site, PT>::instance().thread_counters();
+        counters.binds.fetch_add(1, memory_order_relaxed);
+        for (size_t ix = 0; ix < N; ix++)
+            (supplied[ix] ? counters.supplied[ix] : counters.defaulted[ix]).fetch_add(1, memory_order_relaxed);
+    }
+};
+
+// Snapshot of the counters of all sites which have been bound so far. Binders with the same Site but different parameter types
+// are reported as one site, with their parameters merged by name. A parameter counts the binds of the binders which have it.
+inline vector<bind_site_statistics> bind_statistics()
+{
+    auto& registry = detail::bind_sites();
+    lock_guard lock(registry.lock);
+    vector<bind_site_statistics> ret;
+    for (auto site : registry.sites) {
+        auto stats = site->snapshot();
+        auto same = find_if(ret.begin(), ret.end(), [&](auto& s) { return s.site == stats.site; });
+        if (same == ret.end()) {
+            ret.push_back(std::move(stats));
+            continue;
+        }
+
+        same->binds += stats.binds;
+        for (auto& par : stats.parameters) {
+            auto same_par = find_if(same->parameters.begin(), same->parameters.end(), [&](auto& p) { return p.name == par.name; });
+            if (same_par == same->parameters.end())
+                same->parameters.push_back(par);
+            else {
+                same_par->supplied += par.supplied;
+                same_par->defaulted += par.defaulted;
+            }
+        }
+    }
+
+    return ret;
+}
+
+// Write the statistics of all sites to an ostream-like, one line per site and parameter.
+template<typename OS> void dump_bind_statistics(OS& os)
+{
+    for (auto& site : bind_statistics()) {
+        os << site.site << ": " << site.binds << " binds\n";
+        for (auto& par : site.parameters)
+            os << "    " << par.name << ": " << par.supplied << " supplied, " << par.defaulted << " defaulted\n";
+    }
+}
+
+// basic_parameter_binder is a parameter_binder with an instrumentation policy, see bind_counters. The policy is given as the
+// first constructor argument, as in basic_parameter_binder binder(bind_counters<"draw">(), width = 1, height = 1).
+template<typename POLICY, typename... Pars> class basic_parameter_binder {
 public:
-    parameter_binder(Pars&&... pars) : m_parameters(forward<Pars>(pars)...) {}
-    template<typename... Args> auto bind(Args&&... args) {
-        return detail::call_bind_parameters<0>(forward_as_tuple(std::forward<Args>(args)...), m_parameters);
+    template<typename... Ps> requires (sizeof...(Ps) == sizeof...(Pars))
+    constexpr basic_parameter_binder(POLICY, Ps&&... pars) : m_parameters(detail::owned_parameter_value(forward<Ps>(pars))...) {}
+
+    // Parameters not given by the caller are bound as references to the defaults stored in the binder, so defaults are never
+    // copied by bind. This requires the binder to outlive the result, which is easiest achieved by making it a static const.
+    template<typename... Args> constexpr auto bind(Args&&... args) const & {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::convert, tuple>(forward_as_tuple(std::forward<Args>(args)...), m_parameters, index_sequence_for<Pars...>());
+    }
+    template<template<typename...> class RESULT, typename... Args> constexpr auto bind(Args&&... args) const & {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::convert, RESULT>(forward_as_tuple(std::forward<Args>(args)...), m_parameters, index_sequence_for<Pars...>());
+    }
+
+    // A temporary binder moves its defaults into the result instead.
+    template<typename... Args> constexpr auto bind(Args&&... args) && {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::convert, tuple>(forward_as_tuple(std::forward<Args>(args)...), std::move(m_parameters), index_sequence_for<Pars...>());
+    }
+    template<template<typename...> class RESULT, typename... Args> constexpr auto bind(Args&&... args) && {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::convert, RESULT>(forward_as_tuple(std::forward<Args>(args)...), std::move(m_parameters), index_sequence_for<Pars...>());
+    }
+
+    // As bind, but variant parameters are bound as the alternative selected by the argument type, see bind_static_parameters.
+    template<typename... Args> constexpr auto bind_static(Args&&... args) const & {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::static_alternative, tuple>(forward_as_tuple(std::forward<Args>(args)...), m_parameters, index_sequence_for<Pars...>());
+    }
+    template<typename... Args> constexpr auto bind_static(Args&&... args) && {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::static_alternative, tuple>(forward_as_tuple(std::forward<Args>(args)...), std::move(m_parameters), index_sequence_for<Pars...>());
+    }
+
+    // As bind, but arguments which need a conversion are converted on first access, see bind_lazy_parameters.
+    template<typename... Args> constexpr auto bind_lazy(Args&&... args) const & {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::lazy, tuple>(forward_as_tuple(std::forward<Args>(args)...), m_parameters, index_sequence_for<Pars...>());
+    }
+
+    // As bind, but all parameters are bound by value, see bind_owned_parameters. A binder which is an rvalue moves its defaults
+    // into the result.
+    template<typename... Args> constexpr auto bind_owned(Args&&... args) const & {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::owned, tuple>(forward_as_tuple(std::forward<Args>(args)...), m_parameters, index_sequence_for<Pars...>());
+    }
+    template<typename... Args> constexpr auto bind_owned(Args&&... args) && {
+        record<Args...>();
+        return detail::call_bind_parameters<detail::bind_mode::owned, tuple>(forward_as_tuple(std::forward<Args>(args)...), std::move(m_parameters), index_sequence_for<Pars...>());
+    }
+
+    // Derive a binder with some of the defaults overridden, see layered_binder. The result refers to this binder.
+    template<typename... Ps> requires (detail::converts_to_override<tuple<Pars...>, Ps> && ...) constexpr auto derive(Ps&&... overrides) const & {
+        return layered_binder<basic_parameter_binder, detail::override_t<tuple<Pars...>, Ps>...>(*this, forward<Ps>(overrides)...);
+    }
+    template<typename... Ps> void derive(Ps&&... overrides) && = delete;
+
+    using parameter_types = tuple<Pars...>;
+    using policy = POLICY;
+    constexpr const tuple<Pars...>& defaults() const { return m_parameters; }
+
+    // Bind a range of argument sets, each a tuple-like of named arguments of the same type, for instance to call a function for
+    // many items with per item overrides. The result is a struct of arrays: For each parameter a named vector with one element
+    // per argument set, where parameters not given in the sets get copies of their default. Name matching is done once for the
+    // argument set type, and each vector is then filled by a loop of its own, so that the callee can process it a column at
+    // a time. bool parameters are stored as unsigned char to keep the vectors contiguous.
+    template<typename R> auto bind_many(const R& argument_sets) const {
+        using S = remove_cvref_t<decltype(*begin(argument_sets))>;
+        POLICY::template on_bind<tuple<Pars...>, S>(uint64_t(distance(begin(argument_sets), end(argument_sets))));
+        return detail::bind_batch<S>(argument_sets, m_parameters, index_sequence_for<Pars...>());
+    }
+
+    // Bind parameters given at runtime as a range of key/value pairs, for instance read from a configuration file. Each key is
+    // looked up in a perfect hash table of the parameter names, which requires the names to be string literals. As the result
+    // can't refer to values converted at runtime it is of the type bind_owned returns, with each parameter constructed in place
+    // from the value of its key, or copied from its default if the key is not given. A value is used only if the parameter type
+    // can be constructed from the value type. Unknown keys and values of the wrong type are reported by calling
+    // on_error(key, error) and are otherwise ignored. If a key appears more than once the last value is used.
+    template<typename R, typename F> auto bind_keys(const R& key_values, F&& on_error) const {
+        using table = detail::name_hash_table<Pars...>;
+        using V = remove_cvref_t<tuple_element_t<1, remove_cvref_t<decltype(*begin(key_values))>>>;
+        static constexpr bool accepts[] = { is_constructible_v<typename Pars::type, const V&>... };
+        // A range which yields its pairs by value, such as a transforming view, destroys each pair after its iteration, so the
+        // values used are kept here until the result is constructed.
+        static constexpr bool keeps_values = !is_lvalue_reference_v<decltype(*begin(key_values))>;
+        conditional_t<keeps_values, array<optional<V>, sizeof...(Pars)>, tuple<>> kept;
+        array<const V*, sizeof...(Pars)> values{};
+        for (auto&& [key, value] : key_values) {
+            size_t ix = table::find(key);
+            if (ix == npos)
+                on_error(string_view(key), bind_key_error::unknown_key);
+            else if (!accepts[ix])
+                on_error(string_view(key), bind_key_error::wrong_type);
+            else if constexpr (keeps_values)
+                values[ix] = &kept[ix].emplace(std::move(value));
+            else
+                values[ix] = &value;
+        }
+
+        array<bool, sizeof...(Pars)> supplied{};
+        for (size_t ix = 0; ix < values.size(); ix++)
+            supplied[ix] = values[ix] != nullptr;
+        POLICY::template on_bind<tuple<Pars...>>(supplied);
+        return detail::bind_key_values<decltype(bind_owned())>(m_parameters, values, index_sequence_for<Pars...>());
+    }
+    template<typename R> auto bind_keys(const R& key_values) const {
+        return bind_keys(key_values, [](string_view, bind_key_error) {});
     }
 
 private:
+    template<typename... Args> static constexpr void record() {
+        POLICY::template on_bind<tuple<Pars...>, tuple<decay_t<Args>...>>();
+    }
+
     tuple<Pars...> m_parameters;
 };
 
+template<typename POLICY, typename... Ps> basic_parameter_binder(POLICY, Ps&&...) -> basic_parameter_binder<POLICY, detail::owned_parameter_t<Ps>...>;
+
+template<typename... Pars> class parameter_binder : public basic_parameter_binder<no_bind_instrumentation, Pars...> {
+public:
+    template<typename... Ps> requires (sizeof...(Ps) == sizeof...(Pars) && (!is_same_v<decay_t<Ps>, parameter_binder> && ...))
+    constexpr parameter_binder(Ps&&... pars) : basic_parameter_binder<no_bind_instrumentation, Pars...>(no_bind_instrumentation(), forward<Ps>(pars)...) {}
+};
+
+template<typename... Ps> parameter_binder(Ps&&...) -> parameter_binder<detail::owned_parameter_t<Ps>...>;
+
+
+// A layered_binder overrides some of the defaults of a base binder, which may itself be a layered_binder, for instance to
+// have library wide defaults, per subsystem overrides and per call arguments. It stores only the overriding values and refers
+// to the base binder for the rest, so the base must outlive it. Which layer each default comes from is decided at compile
+// time, and bind binds to references to the defaults of the right layers, so binding through several layers costs the same
+// as binding through one.
+template<typename BASE, typename... Ovs> class layered_binder {
+public:
+    using parameter_types = typename BASE::parameter_types;
+    using policy = typename BASE::policy;
+
+    template<typename... Ps> constexpr layered_binder(const BASE& base, Ps&&... overrides) :
+        m_base(base), m_overrides(Ovs(detail::converted_in_place<typename Ovs::type>(detail::owned_parameter_value(forward<Ps>(overrides))))...) {}
+
+    // The defaults of all parameters, as references to the layers they come from.
+    constexpr auto defaults() const {
+        return layered_defaults(m_base.defaults(), make_index_sequence<tuple_size_v<parameter_types>>());
+    }
+
+    template<typename... Args> constexpr auto bind(Args&&... args) const {
+        policy::template on_bind<parameter_types, tuple<decay_t<Args>...>>();
+        return detail::call_bind_parameters<detail::bind_mode::convert, tuple>(forward_as_tuple(std::forward<Args>(args)...), defaults(), make_index_sequence<tuple_size_v<parameter_types>>());
+    }
+    template<template<typename...> class RESULT, typename... Args> constexpr auto bind(Args&&... args) const {
+        policy::template on_bind<parameter_types, tuple<decay_t<Args>...>>();
+        return detail::call_bind_parameters<detail::bind_mode::convert, RESULT>(forward_as_tuple(std::forward<Args>(args)...), defaults(), make_index_sequence<tuple_size_v<parameter_types>>());
+    }
+    template<typename... Args> constexpr auto bind_static(Args&&... args) const {
+        policy::template on_bind<parameter_types, tuple<decay_t<Args>...>>();
+        return detail::call_bind_parameters<detail::bind_mode::static_alternative, tuple>(forward_as_tuple(std::forward<Args>(args)...), defaults(), make_index_sequence<tuple_size_v<parameter_types>>());
+    }
+
+    template<typename... Ps> requires (detail::converts_to_override<parameter_types, Ps> && ...) constexpr auto derive(Ps&&... overrides) const & {
+        return layered_binder<layered_binder, detail::override_t<parameter_types, Ps>...>(*this, forward<Ps>(overrides)...);
+    }
+    template<typename... Ps> void derive(Ps&&... overrides) && = delete;
+
+private:
+    template<typename B, size_t... IXs> constexpr auto layered_defaults(const B& base, index_sequence<IXs...>) const {
+        return tuple<const tuple_element_t<IXs, parameter_types>&...>(layered_default<IXs>(base)...);
+    }
+    template<size_t IX, typename B> constexpr decltype(auto) layered_default(const B& base) const {
+        constexpr size_t OIX = tuple_find<tuple_element_t<IX, parameter_types>::name, type_list<Ovs...>>();
+        if constexpr (OIX == npos)
+            return get<IX>(base);
+        else
+            return get<OIX>(m_overrides);
+    }
+
+    const BASE& m_base;
+    tuple<Ovs...> m_overrides;
+};
+
+
+// named_function makes it possible to implement a function with named parameters as one non-template body, for instance
+// in a .cpp file or behind a shared library boundary. The body gets the bound parameters as a named_frame_t, a tuple of
+// named references to the arguments or defaults, which the call operator builds on the caller's stack. The call operator
+// is a template but only binds and makes one call through a function pointer. The binder must outlive the named_function.
+//
+// inline const std::parameter_binder draw_defaults(width = 1, color = "black"s);
+// int draw_body(const std::named_frame_t<decltype(draw_defaults)>& args);     // Defined in a .cpp file.
+// inline const std::named_function draw(draw_defaults, draw_body);
+namespace detail {
+    template<typename PT> struct named_frame;
+    template<typename... Pars> struct named_frame<tuple<Pars...>> {
+        using type = tuple<named_value<Pars::name, const decay_t<typename Pars::type>&>...>;
+    };
+}
+
+template<typename BINDER> using named_frame_t = typename detail::named_frame<typename BINDER::parameter_types>::type;
+
+template<typename BINDER, typename R> class named_function {
+public:
+    using frame = named_frame_t<BINDER>;
+
+    constexpr named_function(const BINDER& binder, R (*body)(const frame&)) : m_binder(&binder), m_body(body) {}
+
+    template<typename... Args> R operator()(Args&&... args) const {
+        return call(m_binder->bind(forward<Args>(args)...), make_index_sequence<tuple_size_v<frame>>());
+    }
+
+private:
+    template<typename B, size_t... IXs> R call(const B& bound, index_sequence<IXs...>) const {
+        return m_body(frame(get<IXs>(bound).value...));
+    }
+
+    const BINDER* m_binder;
+    R (*m_body)(const frame&);
+};
+
 
 
 }   // namespace std
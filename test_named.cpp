@@ -3,6 +3,15 @@
 #include "named.h"
 
 #include<iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
 
 inline const char* first_tag = "first";
 std::value_name<first_tag> first;
@@ -13,24 +22,88 @@ std::value_name<third_tag> third;
 inline const char* fourth_tag = "fourth";
 std::value_name<fourth_tag> fourth;
 
+// Names given as string literals compare by content, so the same name may be declared in several places.
+std::value_name<"fifth"> fifth;
+namespace other {
+    std::value_name<"fifth"> fifth;
+}
+
 struct Point { 
     Point(int x, int y) : x(x), y(y) {}
     int x, y; 
 };
 
+// Counts copies and moves to check how many times bound values are constructed.
+struct Counted {
+    Counted(int v) : v(v) {}
+    Counted(const Counted& src) : v(src.v) { copies++; }
+    Counted(Counted&& src) noexcept : v(src.v) { moves++; }
+
+    int v;
+    static inline int copies = 0;
+    static inline int moves = 0;
+};
+
+// Can only be constructed in place.
+struct Immovable {
+    Immovable(int x, int y) : v(x * 10 + y) {}
+    Immovable(const Immovable&) = delete;
+    Immovable(Immovable&&) = delete;
+
+    int v;
+};
+
+// Counts the conversions from const char*.
+struct Text {
+    Text(const char* s) : s(s) { conversions++; }
+
+    std::string s;
+    static inline int conversions = 0;
+};
+
+// True if binder can derive a layered_binder overriding a default with p.
+template<typename B, typename P> concept can_derive = requires(const B& binder, P&& p) { binder.derive(std::forward<P>(p)); };
+
+// Binding is constexpr, so functions with named parameters can be evaluated at compile time.
+constexpr std::parameter_binder extent_defaults(first = 1, second = 1);
+template<typename... Ps> constexpr int area(Ps&&... ps)
+{
+    auto args = extent_defaults.bind(std::forward<Ps>(ps)...);
+    return std::get<first>(args) * std::get<second>(args);
+}
+static_assert(area() == 1 && area(second = 3, first = 2) == 6);
+constexpr std::array<int, 3> areas = { area(first = 2), area(second = 3), area(first = 4, second = 5) };
+static_assert(areas[2] == 20);
+
+// Defaults given as temporaries are bound by value.
+static_assert([] {
+    auto args = std::bind_parameters(std::forward_as_tuple(second = 3), first = 4, second = 0);
+    return std::get<first>(args) + std::get<second>(args);
+}() == 7);
+
+// A function with named parameters implemented by a non-template body.
+static const std::parameter_binder extent_binder(first = 1, second = 2.5, third = Point{ 0, 0 });
+double extent_body(const std::named_frame_t<decltype(extent_binder)>& args)
+{
+    const Point& p = std::get<third>(args);
+    return std::get<first>(args) * std::get<second>(args) + p.x + p.y;
+}
+static const std::named_function extent(extent_binder, extent_body);
+
 template<typename... Ps> auto test_function(Ps&&... ps)
 {
 //    auto t = std::forward_as_tuple(std::forward<Ps>(ps)...);
 //    auto args = std::bind_parameters(t, second.variant<std::string, Point>("Hopp"), third = Point{ 0, 0 }, first.optional<int>());
-    std::parameter_binder binder(second.variant<std::string, Point>("Hopp"), third = Point{ 0, 0 }, first.optional<int>(), fourth.any(8));
+    // The defaults are constructed once and parameters not given are bound as references to them.
+    static const std::parameter_binder binder(second.variant<std::string, Point>("Hopp"), third = Point{ 0, 0 }, first.optional<int>(), fourth.any(8));
     auto args = binder.bind(std::forward<Ps>(ps)...);
-    auto var = std::get<0>(args).value;
+    const auto& var = std::get<0>(args).value;
     auto name = get<std::string>(var);
-    int value = 0;
+    [[maybe_unused]] int value = 0;
     if (std::get<first>(args))
         std::cout << *std::get<first>(args);
-    auto p = std::get<third>(args);
-    std::any f = std::get<fourth>(args);
+    [[maybe_unused]] auto p = std::get<third>(args);
+    const std::any& f = std::get<fourth>(args);
     if (auto ip = any_cast<int>(&f))
         std::cout << *ip;
     if (auto cp = any_cast<const char*>(&f))
@@ -40,11 +113,359 @@ template<typename... Ps> auto test_function(Ps&&... ps)
 
 void test_named()
 {
-    constexpr bool no = &first_tag == &second_tag;
+    [[maybe_unused]] constexpr bool no = &first_tag == &second_tag;
     int xval = 3;
     auto x = first = xval;
-    auto y = std::move(x);
-    
+    [[maybe_unused]] auto y = std::move(x);
+
+    // Lookup by name finds both named_values and value_names.
+    using args = std::tuple<decltype(second = 1), int, std::value_name<first_tag>&, decltype(second = 2)>;
+    static_assert(std::tuple_find<first_tag, args>() == 2);
+    static_assert(std::tuple_find<second_tag, 1, args>() == 3);
+    static_assert(std::tuple_find_nth<second_tag, 1, args>() == 3);
+    static_assert(std::tuple_count_if<second_tag, args>() == 2);
+    static_assert(!std::tuple_contains<third_tag, args>());
+
+    // By value elements are returned with the value category and constness of the tuple.
+    {
+        const std::tuple<std::named_value<first_tag, std::string>> ct(std::string("const"));
+        static_assert(std::is_same_v<decltype(std::get<first>(ct)), const std::string&>);
+        std::tuple<std::named_value<first_tag, std::string>> t(std::string("kept"));
+        auto copy = std::get<first>(t);
+        assert(copy == "kept" && std::get<first>(t) == "kept");
+        static_assert(std::is_same_v<decltype(std::get<first>(std::move(t))), std::string&&>);
+    }
+
+    // Literal names are the same name wherever they are declared.
+    {
+        static_assert(std::is_same_v<decltype(fifth), decltype(other::fifth)>);
+        auto bound = std::bind_parameters(std::forward_as_tuple(other::fifth = 5), fifth = 0, first = 1);
+        assert(std::get<fifth>(bound) == 5 && std::get<first>(bound) == 1);
+    }
+
+    // named_values refer to the tag variable of their name, so their types mangle as when names could only be given as tag
+    // variables. Literal names mangle as their characters packed eight to a word instead of one literal per character, which
+    // for this name would be 32 literals of at least 5 characters each.
+    {
+        [[maybe_unused]] std::string tag_mangled = typeid(std::named_value<first_tag, int>).name();
+        [[maybe_unused]] std::string literal_mangled = typeid(decltype(std::value_name<"a_name_of_thirty_two_characters_">() = 1)).name();
+#ifndef _MSC_VER
+        assert(tag_mangled == "St11named_valueIL_Z9first_tagEiE");
+        assert(literal_mangled.size() < 160);
+#endif
+    }
+
+    // Binding from runtime key/value pairs.
+    {
+        static const std::parameter_binder binder(std::value_name<"count">() = 1, fifth.optional<int>(), std::value_name<"title">() = std::string("none"));
+        std::vector<std::pair<std::string_view, int>> config = { { "fifth", 5 }, { "bogus", 2 }, { "title", 3 }, { "count", 4 } };
+        std::vector<std::pair<std::string_view, std::bind_key_error>> errors;
+        auto bound = binder.bind_keys(config, [&](std::string_view key, std::bind_key_error error) { errors.emplace_back(key, error); });
+        assert(*std::get<fifth>(bound) == 5 && std::get<2>(bound).value == "none" && std::get<0>(bound).value == 4);
+        assert(errors.size() == 2);
+        assert(errors[0].first == "bogus" && errors[0].second == std::bind_key_error::unknown_key);
+        assert(errors[1].first == "title" && errors[1].second == std::bind_key_error::wrong_type);
+
+        // Ranges may yield their pairs by value, as when parsing lines with a transforming view.
+        std::vector<std::string> lines = { "count=7", "fifth=8" };
+        auto parsed = lines | std::views::transform([](const std::string& line) {
+            size_t eq = line.find('=');
+            return std::pair<std::string, int>(line.substr(0, eq), std::stoi(line.substr(eq + 1)));
+        });
+        auto from_lines = binder.bind_keys(parsed);
+        assert(std::get<0>(from_lines).value == 7 && *std::get<fifth>(from_lines) == 8 && std::get<2>(from_lines).value == "none");
+
+        // The result is built in place: Given parameters are constructed from their values and the others copied from their
+        // defaults, so the types need not be assignable.
+        struct Limit {
+            Limit(int v) : v(v) {}
+            const int v;
+        };
+        std::value_name<"low"> low;
+        std::value_name<"high"> high;
+        std::value_name<"limit"> limit;
+        static const std::parameter_binder counted(low = Counted(1), high = Counted(2), limit = Limit(3));
+        Counted::copies = Counted::moves = 0;
+        auto keyed = counted.bind_keys(std::vector<std::pair<std::string, int>>{ { "low", 5 }, { "limit", 6 } });
+        static_assert(std::is_same_v<decltype(keyed), decltype(counted.bind_owned())>);
+        assert(std::get<0>(keyed).value.v == 5 && std::get<1>(keyed).value.v == 2 && std::get<2>(keyed).value.v == 6);
+        assert(Counted::copies == 1 && Counted::moves == 0);
+    }
+
+    // small_any keeps values inline and allocates only if allowed to.
+    {
+        std::small_any<> a = 5;
+        assert(*a.get_if<int>() == 5 && a.get_if<float>() == nullptr);
+        std::small_any<> b = a;
+        a = 2.5;
+        assert(*a.get_if<double>() == 2.5 && *b.get_if<int>() == 5);
+
+        std::small_any<sizeof(std::string)> s = std::string("inline");
+        auto t = std::move(s);
+        assert(!s.has_value() && *t.get_if<std::string>() == "inline");
+        t = *t.get_if<std::string>();       // Assigning a small_any its own value.
+        assert(*t.get_if<std::string>() == "inline");
+
+        // An empty small_any constructs the value directly in its storage, replacing a value constructs it before the old
+        // value is destroyed.
+        std::small_any<> c;
+        Counted::copies = Counted::moves = 0;
+        c.emplace<Counted>(1);
+        assert(Counted::copies == 0 && Counted::moves == 0);
+        c.emplace<Counted>(c.get_if<Counted>()->v + 1);
+        assert(c.get_if<Counted>()->v == 2 && Counted::copies == 0 && Counted::moves == 1);
+
+        std::small_any<sizeof(void*), true> h = std::string("on the heap");
+        auto h2 = h;
+        assert(*h.get_if<std::string>() == *h2.get_if<std::string>() && h.get_if<std::string>() != h2.get_if<std::string>());
+        h2 = *h2.get_if<std::string>();
+        assert(*h2.get_if<std::string>() == "on the heap");
+        h.reset();
+        assert(!h.has_value());
+
+        auto bound = std::bind_parameters(std::forward_as_tuple(fourth = 7), fourth.small_any(8), first.small_any());
+        assert(*std::get<fourth>(bound).get_if<int>() == 7 && !std::get<first>(bound).has_value());
+    }
+
+    // Variant parameters bound as the alternative selected by the argument.
+    {
+        static const std::parameter_binder binder(second.variant<std::string, Point>("Hopp"));
+        Point p{ 1, 2 };
+        auto point = binder.bind_static(second = p);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::get<second>(point))>, Point>);
+        auto text = binder.bind_static(second = "text");
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::get<second>(text))>, std::string>);
+
+        std::variant<std::string, Point> erased = Point{ 3, 4 };
+        auto dynamic = binder.bind_static(second = erased);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::get<second>(dynamic))>, std::variant<std::string, Point>>);
+
+        auto size = [](const auto& v) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(v)>, Point>)
+                return size_t(v.x + v.y);
+            else
+                return v.size();
+        };
+        assert(std::visit<second>(size, point) == 3 && std::visit<second>(size, text) == 4);
+        assert(std::visit<second>(size, dynamic) == 7 && std::visit<second>(size, binder.bind_static()) == 4);
+
+        // Alternatives are selected as by the converting constructor of variant, which doesn't convert pointers to bool or narrow.
+        static const std::parameter_binder flags(second.variant<std::string, bool>(false), third.variant<float, long>(0L));
+        auto eager = flags.bind(second = "text");
+        auto selected = flags.bind_static(second = "text");
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::get<second>(selected))>, std::string>);
+        assert(std::get<second>(eager).index() == 0 && std::get<second>(selected) == "text");
+        int count = 2;
+        auto whole = flags.bind_static(third = count);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::get<third>(whole))>, long>);
+        assert(std::get<third>(whole) == 2 && std::get<third>(flags.bind(third = count)).index() == 1);
+    }
+
+    // Arguments of the parameter type are bound by reference, also when they are tuple-likes.
+    {
+        std::vector<int> v{ 1, 2, 3 };
+        std::array<int, 3> a{ 4, 5, 6 };
+        auto bound = std::bind_parameters(std::forward_as_tuple(first = v, second = a), first = std::vector<int>(), second = std::array<int, 3>());
+        assert(&std::get<first>(bound) == &v && &std::get<second>(bound) == &a);
+
+        std::string s = "referenced";
+        auto found = std::tuple(second = s);
+        assert((&std::get_or<second_tag, std::string>(std::string(), found) == &s));
+    }
+
+    // Each matched argument is constructed once, directly into the result.
+    {
+        Counted::copies = Counted::moves = 0;
+        auto bound = std::bind_parameters(std::forward_as_tuple(fourth = 5, first), second = 1, fourth = Counted(0), first.optional<bool>());
+        assert(std::get<fourth>(bound).v == 5 && std::get<second>(bound) == 1 && *std::get<first>(bound));
+        assert(Counted::copies == 0 && Counted::moves == 0);
+    }
+
+    // Defaults are not copied when binding through a binder which outlives the result, and moved out of a temporary binder.
+    {
+        static const std::parameter_binder binder(fourth = Counted(7), first.optional<int>());
+        Counted::moves = 0;
+        auto bound = binder.bind(first = 3);
+        assert(std::get<fourth>(bound).v == 7 && *std::get<first>(bound) == 3);
+        assert(Counted::copies == 0 && Counted::moves == 0);
+
+        auto owned = std::parameter_binder(fourth = Counted(7)).bind();
+        static_assert(std::is_same_v<decltype(owned), std::tuple<std::named_value<fourth_tag, Counted>>>);
+        assert(std::get<fourth>(owned).v == 7 && Counted::copies == 0);
+    }
+
+    // A packed result stores the parameters ordered by alignment but is still accessed by name and in declaration order.
+    {
+        auto packed = std::bind_parameters<std::packed_tuple>(std::forward_as_tuple(third = 2.5), first = false, second = 7, third = 0.0, fourth = true);
+        auto plain = std::bind_parameters(std::forward_as_tuple(third = 2.5), first = false, second = 7, third = 0.0, fourth = true);
+        static_assert(std::is_same_v<std::tuple_element_t<1, decltype(packed)>, std::tuple_element_t<1, decltype(plain)>>);
+        // The optimal size is the sum of the element sizes, rounded up to the largest alignment.
+        constexpr size_t optimal_size = (sizeof(double) + sizeof(int) + 2 * sizeof(bool) + alignof(double) - 1) / alignof(double) * alignof(double);
+        static_assert(sizeof(packed) == optimal_size && sizeof(packed) < sizeof(plain));
+        assert(!std::get<first>(packed) && std::get<second>(packed) == 7 && std::get<third>(packed) == 2.5 && std::get<fourth>(packed));
+        assert(std::get<1>(packed).value == 7);
+
+        static const std::parameter_binder binder(first = false, second = 7, third = 0.0, fourth = true);
+        auto bound = binder.bind<std::packed_tuple>(fourth = false);
+        assert(std::get<second>(bound) == 7 && !std::get<fourth>(bound));
+    }
+
+    // A batch is bound to one vector per parameter.
+    {
+        static const std::parameter_binder binder(first = 1, second = 0.5, third = Point{ 0, 0 }, fourth = false);
+        using item = std::tuple<std::named_value<decltype(third)::name, std::tuple<int, int>>, std::named_value<decltype(first)::name, int>>;
+        std::vector<item> items = { { { 1, 2 }, 3 }, { { 4, 5 }, 6 }, { { 7, 8 }, 9 } };
+        auto batch = binder.bind_many(items);
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(std::get<fourth>(batch))>, std::vector<unsigned char>>);
+        const std::vector<Point>& points = std::get<third>(batch);
+        assert(points.size() == 3 && points[2].x == 7 && points[2].y == 8);
+        assert((std::get<first>(batch) == std::vector<int>{ 3, 6, 9 }));
+        assert((std::get<second>(batch) == std::vector<double>(3, 0.5) && std::get<fourth>(batch) == std::vector<unsigned char>(3, 0)));
+    }
+
+    // Layered binders store only their overrides and bind to references to the defaults of the layer they come from.
+    {
+        static const std::parameter_binder library(first = 1, second = 0.5, fourth = Counted(7));
+        static const auto subsystem = library.derive(second = 2);
+        static const auto call = subsystem.derive(first = 3);
+        Counted::copies = Counted::moves = 0;
+        auto bound = call.bind(second = 4.5);
+        static_assert(std::is_same_v<decltype(bound), decltype(library.bind(second = 4.5))>);
+        const Counted& c = std::get<fourth>(bound);
+        assert(std::get<first>(bound) == 3 && std::get<second>(bound) == 4.5 && &c == &std::get<2>(library.defaults()).value);
+        assert(std::get<second>(subsystem.bind()) == 2.0 && std::get<first>(subsystem.bind()) == 1);
+        assert(Counted::copies == 0 && Counted::moves == 0);
+    }
+
+    // Overrides are converted to the parameter type as arguments are, so they may not narrow.
+    {
+        static const std::parameter_binder library(first = 1, second = 0.5);
+        static_assert(!can_derive<decltype(library), decltype(first = 2.7)>);
+        static_assert(!can_derive<decltype(library.derive(second = 2)), decltype(first = 2.7)>);
+        static_assert(can_derive<decltype(library), decltype(first = short(2))>);
+        static const auto exact = library.derive(second = 2);
+        assert(std::get<second>(exact.bind()) == 2.0);
+    }
+
+    // Calls through a named_function all reach the same body.
+    {
+        static_assert(std::is_same_v<std::tuple_element_t<1, decltype(extent)::frame>, std::named_value<decltype(second)::name, const double&>>);
+        assert(extent() == 2.5 && extent(first = 2) == 5 && extent(third(1, 2), second = 1) == 4);
+    }
+
+    // Arguments with literal names bind the same in any order, and arguments with the same name keep their order.
+    {
+        static const std::parameter_binder binder(std::value_name<"count">() = 1, fifth = 0, std::value_name<"title">() = std::string("none"), fifth = 0);
+        auto a = binder.bind(fifth = 5, std::value_name<"title">() = "a", std::value_name<"count">() = 2, fifth = 6);
+        auto b = binder.bind(std::value_name<"count">() = 2, fifth = 5, fifth = 6, std::value_name<"title">() = "a");
+        static_assert(std::is_same_v<decltype(a), decltype(b)>);
+        assert(std::get<1>(a).value == 5 && std::get<3>(a).value == 6 && std::get<0>(a).value == 2 && std::get<2>(a).value == "a");
+        assert(std::get<1>(b).value == 5 && std::get<3>(b).value == 6 && std::get<0>(b).value == 2 && std::get<2>(b).value == "a");
+    }
+
+    // Instrumented binders count which parameters callers supply. The default policy takes no space.
+    {
+        static_assert(sizeof(std::parameter_binder<std::named_value<first_tag, int>>) == sizeof(int));
+        static const std::basic_parameter_binder binder(std::bind_counters<"test_site">(), first = 1, std::value_name<"count">() = 2);
+        binder.bind();
+        binder.bind(first = 3);
+        binder.bind(std::value_name<"count">() = 4, first = 5);
+        auto stats = std::bind_statistics();
+        auto site = std::find_if(stats.begin(), stats.end(), [](auto& s) { return s.site == "test_site"; });
+        assert(site != stats.end() && site->binds == 3);
+        assert(site->parameters[0].name == "first" && site->parameters[0].supplied == 2 && site->parameters[0].defaulted == 1);
+        assert(site->parameters[1].name == "count" && site->parameters[1].supplied == 1 && site->parameters[1].defaulted == 2);
+        std::ostringstream dump;
+        std::dump_bind_statistics(dump);
+        assert(dump.str().find("test_site: 3 binds\n    first: 2 supplied, 1 defaulted\n    count: 1 supplied, 2 defaulted\n") != std::string::npos);
+    }
+
+    // Binds through derived binders, bind_keys and bind_many are counted too, and binders sharing a site label share its row.
+    {
+        std::value_name<"count"> count;
+        static const std::basic_parameter_binder binder(std::bind_counters<"merged_site">(), count = 1, fifth = 2);
+        static const std::basic_parameter_binder other(std::bind_counters<"merged_site">(), count = 0);
+        binder.bind();
+        binder.derive(count = 3).bind(fifth = 4);
+        binder.bind_keys(std::vector<std::pair<std::string, int>>{ { "fifth", 5 } });
+        std::vector<std::tuple<std::named_value<decltype(count)::name, int>>> sets = { { 6 }, { 7 } };
+        binder.bind_many(sets);
+        other.bind(count = 8);
+        auto stats = std::bind_statistics();
+        assert(std::count_if(stats.begin(), stats.end(), [](auto& s) { return s.site == "merged_site"; }) == 1);
+        std::ostringstream dump;
+        std::dump_bind_statistics(dump);
+        assert(dump.str().find("merged_site: 6 binds\n    count: 3 supplied, 3 defaulted\n    fifth: 2 supplied, 3 defaulted\n") != std::string::npos);
+    }
+
+    // Owned binding copies or moves each argument once, directly into the result, which can then outlive the arguments.
+    {
+        static const std::parameter_binder binder(first = 0, fourth = Counted(4), fifth = std::string("default"));
+        Counted::copies = Counted::moves = 0;
+        int offset = 3;
+        auto task = [args = binder.bind_owned(fourth = Counted(5), first = offset)] { return std::get<fourth>(args).v + std::get<first>(args); };
+        static_assert(std::is_same_v<std::tuple_element_t<0, decltype(binder.bind_owned(first = offset))>, std::named_value<decltype(first)::name, int>>);
+        static_assert(std::is_same_v<std::tuple_element_t<2, decltype(binder.bind_owned())>, std::named_value<decltype(fifth)::name, std::string>>);
+        assert(Counted::copies == 0 && Counted::moves == 1);
+        assert(task() == 8);
+
+        auto defaults = binder.bind_owned();
+        assert(Counted::copies == 1 && Counted::moves == 1 && std::get<fourth>(defaults).v == 4 && std::get<fifth>(defaults) == "default");
+
+        std::string text = "moved";
+        auto moved = std::parameter_binder(fourth = Counted(6), fifth = std::string()).bind_owned(fifth = std::move(text));
+        assert(Counted::copies == 1 && Counted::moves == 3 && std::get<fifth>(moved) == "moved");
+    }
+
+    // Defaults given by emplace and arguments given by their constructor arguments are constructed in place, so parameter
+    // types need not be movable.
+    {
+        static const std::parameter_binder binder(first.emplace<std::atomic<int>>(1), third.emplace<Immovable>(1, 2));
+        auto defaults = binder.bind();
+        assert(std::get<first>(defaults).load() == 1 && std::get<third>(defaults).v == 12);
+
+        auto args = binder.bind(third(3, 4));
+        static_assert(std::is_same_v<std::tuple_element_t<1, decltype(args)>, std::named_value<decltype(third)::name, Immovable>>);
+        assert(&std::get<first>(args) == &std::get<first>(defaults) && std::get<third>(args).v == 34);
+
+        auto packed = binder.bind<std::packed_tuple>(third(5, 6));
+        auto owned = binder.bind_owned(first = 7, third(8, 9));
+        assert(std::get<third>(packed).v == 56 && std::get<first>(owned).load() == 7 && std::get<third>(owned).v == 89);
+    }
+
+    // Lazily bound arguments are converted on first access only.
+    {
+        static const std::parameter_binder binder(first = Text("default"), second = 0.0, third = Point{ 0, 0 });
+        Text::conversions = 0;
+        const char* unused_text = "unused";
+        int one = 1;
+        auto unused = binder.bind_lazy(first = unused_text, second = one);
+        static_assert(std::is_same_v<std::remove_cvref_t<std::tuple_element_t<0, decltype(unused)>>, std::lazy_named_value<decltype(first)::name, Text, const char*&>>);
+        static_assert(std::is_same_v<decltype(std::get<second>(unused)), double>);
+        assert(std::get<second>(unused) == 1.0 && Text::conversions == 0);
+
+        const char* used_text = "used";
+        int x = 1, y = 2;
+        auto point_args = third(x, y);
+        auto used = binder.bind_lazy(first = used_text, std::move(point_args));
+        assert(std::get<first>(used).s == "used" && std::get<first>(used).s == "used" && Text::conversions == 1);
+        assert(&std::get<first>(used) == &std::get<first>(used) && std::get<third>(used).y == 2);
+        assert(std::get<first>(binder.bind_lazy()).s == "default" && Text::conversions == 1);
+    }
+
+    // Eager and lazy binding convert arguments the same way, by copy-initialization or from the elements of a tuple-like.
+    {
+        static const std::parameter_binder binder(first = std::vector<int>(), second = 0.0, third = std::string());
+        int count = 3, value = 7, one = 1;
+        const char* text = "text";
+        auto sizes = first(count, value);
+        auto eager = binder.bind(sizes, second = one, third = text);
+        auto lazy = binder.bind_lazy(sizes, second = one, third = text);
+        assert(std::get<first>(eager) == std::vector<int>(3, 7) && std::get<first>(lazy) == std::get<first>(eager));
+        assert(std::get<second>(eager) == 1.0 && std::get<second>(lazy) == std::get<second>(eager));
+        assert(std::get<third>(eager) == "text" && std::get<third>(lazy) == std::get<third>(eager));
+    }
+
     test_function();
     test_function(first = 1);
     test_function(first = 1, third(3, 4));
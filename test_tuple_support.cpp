@@ -3,6 +3,7 @@
 #include "tuple_support.h"
 
 #include <cassert>
+#include <string>
 
 
 // Get a predicate that we can use. For mysterious reasons this is not allowed inside main.
@@ -22,16 +23,27 @@ void test_tuple_support()
     static_assert(std::tuple_find_nth<is_int, 0, decltype(t2)>() == 1);
     static_assert(std::tuple_find_nth<is_int, 1, decltype(t2)>() == std::npos);
     static_assert(std::tuple_find_nth<is_int, 2, decltype(a1)>() == 2);
+    static_assert(std::tuple_find<is_int, 1, decltype(t1)>() == std::npos);
+    static_assert(!std::tuple_contains<is_int, 1, decltype(t1)>());
+    static_assert(std::tuple_count_if<is_int, 1, decltype(a1)>() == 2);
+    static_assert(std::tuple_find<is_int, std::tuple<>>() == std::npos);
 
     assert(std::get_or<is_int>(1, t2) == 4);
 
+    // The tuple functions can be used in constant expressions.
+    static_assert(std::get_or<is_int>(2, std::tuple<float, int>(1.0f, 3)) == 3);
+    static_assert(std::get_or<is_int>(2, std::tuple<float>(1.0f)) == 2);
+    static_assert(std::get<2>(std::tuple_concat(std::tuple<int, float>(1, 2.0f), 3)) == 3);
+    static_assert(std::tuple_reverse(std::array<int, 3>{ 1, 2, 3 })[0] == 3);
+    static_assert(std::tuple_erase<0>(std::array<int, 3>{ 1, 2, 3 }) == std::array<int, 2>{ 2, 3 });
+
     // Concatenate two tuples with some strings thrown in.
     auto t3 = std::tuple_concat<std::tuple>("a", t1, "b", a1, "c");
     static_assert(std::tuple_size_v<decltype(t3)> == 8);
     assert(std::get<1>(t3) == 1 && std::get<5>(t3) == 6);  // check the ints should be enough.
     
     // Concat with an empty first parameter
-    auto tx = std::tuple_concat(std::tuple<>(), 3);
+    [[maybe_unused]] auto tx = std::tuple_concat(std::tuple<>(), 3);
 
     // Test the arranger functions using t3.
     auto t4 = std::tuple_slice<1, 5>(t3);
@@ -92,6 +104,61 @@ void test_tuple_support()
     auto t11 = std::tuple_erase<2, 4>(t3);
     static_assert(std::tuple_size_v<decltype(t11)> == 6);
     assert(std::get<1>(t11) == 1 && std::get<2>(t11) == 5 && std::get<4>(t11) == 7);
+
+    // Elements keep their declared types, so the result of erasing from a temporary does not refer to it.
+    auto t12 = std::tuple_erase<0>(std::tuple<int, float>{ 1, 2.0f });
+    static_assert(std::is_same_v<decltype(t12), std::tuple<float>>);
+    assert(std::get<0>(t12) == 2.0f);
+
+    // Non-tuple lvalues are inserted by reference, rvalues by value.
+    int i13 = 9;
+    auto t13 = std::tuple_concat(t1, i13, 10);
+    static_assert(std::is_same_v<decltype(t13), std::tuple<int, float, int&, int>>);
+    assert(&std::get<2>(t13) == &i13 && std::get<3>(t13) == 10);
+
+    // Inserting after the end appends.
+    auto t14 = std::tuple_insert<5>(a1, std::array<int, 1>{ 8 });
+    static_assert(std::is_same_v<decltype(t14), std::array<int, 4>>);
+    assert(std::get<0>(t14) == 5 && std::get<3>(t14) == 8);
+
+    // A packed tuple has the same elements in the same order but stores them in the minimal total size.
+    std::packed_tuple<char, double, int> p15('a', 1.5, 3);
+    static_assert(sizeof(p15) == sizeof(double) + sizeof(int) + sizeof(int) && sizeof(p15) < sizeof(std::tuple<char, double, int>));
+    static_assert(std::is_same_v<std::tuple_element_t<0, decltype(p15)>, char>);
+    assert(std::get<0>(p15) == 'a' && std::get<1>(p15) == 1.5 && std::get<2>(p15) == 3);
+    auto t16 = std::tuple_concat(p15, 4);
+    static_assert(std::is_same_v<decltype(t16), std::packed_tuple<char, double, int, int>>);
+    assert(std::get<0>(t16) == 'a' && std::get<3>(t16) == 4);
+    static_assert(std::get<1>(std::packed_tuple<bool, int>(true, 2)) == 2);
+
+    // Arrays of the same element type are copied as ranges, which works for any size.
+    std::array<int, 3000> a17{};
+    for (size_t ix = 0; ix < a17.size(); ix++)
+        a17[ix] = int(ix);
+    auto t18 = std::tuple_concat(a17, a1, a17);
+    static_assert(std::is_same_v<decltype(t18), std::array<int, 6003>>);
+    assert(t18[2999] == 2999 && t18[3000] == 5 && t18[3003] == 0 && t18[6002] == 2999);
+    auto t19 = std::tuple_slice<1000, 2000>(a17);
+    auto t20 = std::tuple_erase<10, 2990>(a17);
+    auto t21 = std::tuple_reverse(a17);
+    static_assert(std::tuple_size_v<decltype(t19)> == 1000 && std::tuple_size_v<decltype(t20)> == 20);
+    assert(t19[0] == 1000 && t19[999] == 1999 && t20[9] == 9 && t20[10] == 2990 && t21[0] == 2999 && t21[2999] == 0);
+    std::array<std::string, 2> a22{ "moved", "from" };
+    auto t23 = std::tuple_concat(std::move(a22), std::array<std::string, 1>{ "rvalues" });
+    assert(t23[0] == "moved" && t23[2] == "rvalues");
+    static_assert(std::tuple_slice<1, 5>(std::array<int, 3>{ 1, 2, 3 }) == std::array<int, 2>{ 2, 3 });
+
+    // Type level algorithms on type_lists.
+    using types = std::type_list<int, float, int, char, float>;
+    static_assert(std::is_same_v<std::tuple_element_t<3, types>, char>);
+    static_assert(std::is_same_v<std::type_list_filter_t<is_int, types>, std::type_list<int, int>>);
+    static_assert(std::is_same_v<std::type_list_slice_t<1, 3, types>, std::type_list<float, int>>);
+    static_assert(std::is_same_v<std::type_list_slice_t<3, std::npos, types>, std::type_list<char, float>>);
+    static_assert(std::is_same_v<std::type_list_reverse_t<types>, std::type_list<float, char, int, float, int>>);
+    static_assert(std::is_same_v<std::type_list_unique_t<types>, std::type_list<int, float, char>>);
+    static_assert(std::is_same_v<std::type_list_concat_t<types, std::type_list<>, std::type_list<bool>>, std::type_list<int, float, int, char, float, bool>>);
+    static_assert(std::is_same_v<std::type_list_of_t<decltype(t1)>, std::type_list<int, float>>);
+    static_assert(std::tuple_find<is_int, 1, types>() == 2);
 }
 
 
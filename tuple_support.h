@@ -3,6 +3,8 @@
 #include <type_traits>
 #include <tuple>
 #include <array>
+#include <utility>
+#include <algorithm>
 
 // Convenience functions for tuple-likes
 
@@ -10,7 +12,7 @@ namespace std {
 
 // namespace level npos needed as we don't have any class to put it in. The standard should guarantee that all other npos:es are
 // equal to this one.
-constexpr size_t npos = static_cast<size_t>(-1);
+inline constexpr size_t npos = static_cast<size_t>(-1);
 
 
 //////////////// Simple type list class ////////////////
@@ -21,12 +23,27 @@ template<typename... Ts> struct tuple_size<type_list<Ts...>> {
     static constexpr size_t value = sizeof...(Ts);
 };
 
-template<typename T, typename... Ts> struct tuple_element<0, type_list<T, Ts...>> {
-    using type = T;
-};
+// type_pack_element_t is the IXth type of Ts, found without recursing over the preceding types by the compiler builtin if there
+// is one. Else it is the tuple_element of the standard library, which doesn't instantiate the tuple.
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define TUPLE_SUPPORT_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
+#ifdef TUPLE_SUPPORT_HAS_TYPE_PACK_ELEMENT
+
+template<size_t IX, typename... Ts> using type_pack_element_t = __type_pack_element<IX, Ts...>;
+
+#else
+
+template<size_t IX, typename... Ts> using type_pack_element_t = typename tuple_element<IX, tuple<Ts...>>::type;
 
-template<size_t IX, typename T, typename... Ts> struct tuple_element<IX, type_list<T, Ts...>> {
-        using type = typename tuple_element<IX - 1, type_list<Ts...>>::type;
+#endif
+
+template<size_t IX, typename... Ts> struct tuple_element<IX, type_list<Ts...>> {
+    static_assert(IX < sizeof...(Ts), "type_list index out of range");
+    using type = type_pack_element_t<IX, Ts...>;
 };
 
 
@@ -78,14 +95,14 @@ namespace detail {
     template<typename T, typename... Ts> auto common_tuple_traits_helper()
     {
         if constexpr (sizeof...(Ts) == 0)
-            return declval<tuple_traits<T>>();
+            return tuple_traits<T>();
         else if constexpr (is_tuple_like_v<T>) {
             using rest_type = decltype(common_tuple_traits_helper<Ts...>());
             if constexpr (!rest_type::specialized)
-                return declval<tuple_traits<T>>();
+                return tuple_traits<T>();
             else {
                 static_assert(is_same_v<typename tuple_traits<T>::factory, typename rest_type::factory>, "Different tuple likes given to common_tuple_traits");
-                return declval<tuple_traits<T>>();
+                return tuple_traits<T>();
             }
         }
         else
@@ -95,7 +112,7 @@ namespace detail {
     {
         using ret = decltype(common_tuple_traits_helper<Ts...>());
         static_assert(ret::specialized, "No tuple-like to derive return type template from");
-        return declval<ret>();
+        return ret();
     }
 }
 
@@ -170,34 +187,59 @@ template<template<typename LHS, typename RHS> class PRED, typename R> struct pre
 
 //////////////// New tuple functions involving a type predicate ////////////////
 
+namespace detail {
+    // The predicate is evaluated for all elements in one pack expansion, which keeps the instantiation depth constant regardless
+    // of the tuple size. The searches below are then plain constexpr loops over the resulting array.
+    template<template<typename> class PRED, typename TLC, size_t... IXs> constexpr array<bool, sizeof...(IXs)> tuple_matches(index_sequence<IXs...>)
+    {
+        return { PRED<decay_t<tuple_element_t<IXs, TLC>>>::value... };
+    }
+
+    template<template<typename> class PRED, typename TLC> constexpr auto tuple_matches_v = tuple_matches<PRED, TLC>(make_index_sequence<tuple_size_v<TLC>>());
+
+    // Count the elements of a equal to v at or after pos.
+    template<typename T, size_t N> constexpr size_t count_equal(const array<T, N>& a, const T& v, size_t pos)
+    {
+        size_t ret = 0;
+        for (size_t ix = pos; ix < N; ix++)
+            if (a[ix] == v)
+                ret++;
+
+        return ret;
+    }
+
+    // Return the index of the nth element of a equal to v at or after pos, or npos.
+    template<typename T, size_t N> constexpr size_t find_nth_equal(const array<T, N>& a, const T& v, size_t n, size_t pos)
+    {
+        for (size_t ix = pos; ix < N; ix++) {
+            if (a[ix] == v) {
+                if (n == 0)
+                    return ix;
+                n--;
+            }
+        }
+
+        return npos;
+    }
+}
+
 // Count how many element types E satisfy PRED<E>::value at or after POS
 template<template<typename> class PRED, size_t POS, typename TL> constexpr size_t tuple_count_if()
 {
-    if constexpr (POS == tuple_size_v<decay_t<TL>>)
-        return 0;
-    else if constexpr (PRED<decay_t<tuple_element_t<POS, TL>>>::value)
-        return tuple_count_if<PRED, POS + 1, TL>() + 1;
-    else
-        return tuple_count_if<PRED, POS + 1, TL>();
+    return detail::count_equal(detail::tuple_matches_v<PRED, decay_t<TL>>, true, POS);
 }
 template<template<typename> class PRED, typename TL> constexpr size_t tuple_count_if() { return tuple_count_if<PRED, 0, TL>(); }
 
 
 // Check if any element types E satisfies PRED<E>::value at or after POS
-template<template<typename> class PRED, size_t POS, typename TL> constexpr bool tuple_contains() { return tuple_count_if<PRED, TL>() > 0; }
+template<template<typename> class PRED, size_t POS, typename TL> constexpr bool tuple_contains() { return tuple_count_if<PRED, POS, TL>() > 0; }
 template<template<typename> class PRED, typename TL> constexpr bool tuple_contains() { return tuple_contains<PRED, 0, TL>(); }
 
 
 // Return the index of the first matching element at or after POS
 template<template<typename> class PRED, size_t POS, typename TL> constexpr size_t tuple_find()
 {
-    if constexpr (POS == tuple_size_v<decay_t<TL>>) {
-        return npos;
-    }
-    else if constexpr (PRED<decay_t<tuple_element_t<POS, decay_t<TL>>>>::value)
-        return POS;
-    else
-        return tuple_find<PRED, POS + 1, TL>();
+    return detail::find_nth_equal(detail::tuple_matches_v<PRED, decay_t<TL>>, true, 0, POS);
 }
 template<template<typename> class PRED, typename TL> constexpr size_t tuple_find() { return tuple_find<PRED, 0, TL>(); }
 
@@ -205,13 +247,7 @@ template<template<typename> class PRED, typename TL> constexpr size_t tuple_find
 // Find nth matching element at or after pos.
 template<template<typename> class PRED, size_t N, size_t POS, typename TL> constexpr size_t tuple_find_nth()
 {
-    constexpr size_t NEXT = tuple_find<PRED, POS, TL>();
-    if constexpr (NEXT == npos)
-        return npos;
-    else if (N == 0)
-        return NEXT;
-    else
-        return tuple_find_nth<PRED, N - 1, NEXT + 1, TL>();
+    return detail::find_nth_equal(detail::tuple_matches_v<PRED, decay_t<TL>>, true, N, POS);
 }
 template<template<typename> class PRED, size_t N, typename TL> constexpr size_t tuple_find_nth() { return tuple_find_nth<PRED, N, 0, TL>(); }
 
@@ -219,16 +255,231 @@ template<template<typename> class PRED, size_t N, typename TL> constexpr size_t
 // Tuple get with predicate and default value. There is no corresponding function without default value, instead tuple_find
 // must be called separately to make error handling more obvious.
 // Note that get_or may return totally different types depending on whether the find was succesful or not.
-template<template<typename> class PRED, typename D, typename TL> decltype(auto) get_or(D&& defval, TL&& t)
+template<template<typename> class PRED, typename D, typename TL> constexpr decltype(auto) get_or(D&& defval, TL&& t)
 {
     constexpr size_t IX = tuple_find<PRED, decay_t<TL>>();
-    if constexpr (IX == tuple_size_v<decay_t<TL>>)
-        return defval;
+    if constexpr (IX == npos)
+        return forward<D>(defval);
     else
         return get<IX>(std::forward<TL>(t));
 }
 
 
+//////////////// Type level algorithms ////////////////
+
+// These work on type_lists and only instantiate the type_list of the result, never any tuple. Together with tuple_find,
+// tuple_count_if and tuple_contains, which also work for type_lists, they allow computing types without creating tuples.
+
+namespace detail {
+    // The types of TL at the indices in PLAN::value.
+    template<typename TL, typename PLAN> struct type_list_select;
+    template<typename... Ts, typename PLAN> struct type_list_select<type_list<Ts...>, PLAN> {
+        template<size_t... IXs> static auto select(index_sequence<IXs...>) -> type_list<type_pack_element_t<PLAN::value[IXs], Ts...>...>;
+        using type = decltype(select(make_index_sequence<PLAN::value.size()>()));
+    };
+
+    template<size_t N, size_t COUNT> constexpr array<size_t, COUNT> make_matching_indices(const array<bool, N>& matches)
+    {
+        array<size_t, COUNT> ret{};
+        for (size_t ix = 0; ix < COUNT; ix++)
+            ret[ix] = find_nth_equal(matches, true, ix, 0);
+
+        return ret;
+    }
+
+    template<template<typename> class PRED, typename TL> struct filter_indices {
+        static constexpr auto value = make_matching_indices<tuple_size_v<TL>, tuple_count_if<PRED, TL>()>(tuple_matches_v<PRED, TL>);
+    };
+
+    template<size_t FROM, size_t N> constexpr array<size_t, N> make_consecutive_indices()
+    {
+        array<size_t, N> ret{};
+        for (size_t ix = 0; ix < N; ix++)
+            ret[ix] = FROM + ix;
+
+        return ret;
+    }
+
+    template<size_t BEGIN, size_t END, size_t SIZE> struct slice_indices {
+        static constexpr size_t E = END < SIZE ? END : SIZE;
+        static constexpr size_t B = BEGIN < E ? BEGIN : E;
+        static constexpr auto value = make_consecutive_indices<B, E - B>();
+    };
+
+    template<size_t N> constexpr array<size_t, N> make_reverse_indices()
+    {
+        array<size_t, N> ret{};
+        for (size_t ix = 0; ix < N; ix++)
+            ret[ix] = N - 1 - ix;
+
+        return ret;
+    }
+
+    template<size_t SIZE> struct reverse_indices {
+        static constexpr auto value = make_reverse_indices<SIZE>();
+    };
+
+    // The indices of the types which don't occur earlier in Ts.
+    template<typename T, typename... Ts> constexpr size_t first_occurrence()
+    {
+        return find_nth_equal(array<bool, sizeof...(Ts)>{ is_same_v<T, Ts>... }, true, 0, 0);
+    }
+
+    template<size_t N> constexpr size_t count_unique(const array<size_t, N>& firsts)
+    {
+        size_t ret = 0;
+        for (size_t ix = 0; ix < N; ix++) {
+            if (firsts[ix] == ix)
+                ret++;
+        }
+
+        return ret;
+    }
+
+    template<size_t COUNT, size_t N> constexpr array<size_t, COUNT> make_unique_indices(const array<size_t, N>& firsts)
+    {
+        array<size_t, COUNT> ret{};
+        size_t out = 0;
+        for (size_t ix = 0; ix < N; ix++) {
+            if (firsts[ix] == ix)
+                ret[out++] = ix;
+        }
+
+        return ret;
+    }
+
+    template<typename TL> struct unique_indices;
+    template<typename... Ts> struct unique_indices<type_list<Ts...>> {
+        static constexpr array<size_t, sizeof...(Ts)> firsts = { first_occurrence<Ts, Ts...>()... };
+        static constexpr auto value = make_unique_indices<count_unique(firsts)>(firsts);
+    };
+}
+
+// The types of TL satisfying PRED.
+template<template<typename> class PRED, typename TL> using type_list_filter_t = typename detail::type_list_select<TL, detail::filter_indices<PRED, TL>>::type;
+
+// Slice [BEGIN, END) of TL, where END may be npos.
+template<size_t BEGIN, size_t END, typename TL> using type_list_slice_t = typename detail::type_list_select<TL, detail::slice_indices<BEGIN, END, tuple_size_v<TL>>>::type;
+
+template<typename TL> using type_list_reverse_t = typename detail::type_list_select<TL, detail::reverse_indices<tuple_size_v<TL>>>::type;
+
+// The first occurrence of each type of TL.
+template<typename TL> using type_list_unique_t = typename detail::type_list_select<TL, detail::unique_indices<TL>>::type;
+
+namespace detail {
+    template<typename... TLs> struct type_list_concat;
+    template<> struct type_list_concat<> {
+        using type = type_list<>;
+    };
+    template<typename... Ts> struct type_list_concat<type_list<Ts...>> {
+        using type = type_list<Ts...>;
+    };
+    template<typename... Ts, typename... Us, typename... TLs> struct type_list_concat<type_list<Ts...>, type_list<Us...>, TLs...> {
+        using type = typename type_list_concat<type_list<Ts..., Us...>, TLs...>::type;
+    };
+}
+
+template<typename... TLs> using type_list_concat_t = typename detail::type_list_concat<TLs...>::type;
+
+// The element types of a tuple-like as a type_list.
+namespace detail {
+    template<typename TL, size_t... IXs> auto type_list_of(index_sequence<IXs...>) -> type_list<tuple_element_t<IXs, TL>...>;
+}
+
+template<typename TL> using type_list_of_t = decltype(detail::type_list_of<TL>(make_index_sequence<tuple_size_v<TL>>()));
+
+
+namespace detail {
+    // The tuple functions which produce new tuple-likes are implemented by gathering elements from their incoming arguments
+    // according to a gather_plan computed at compile time. For each element of the result the plan holds which argument and
+    // which element of that argument to take, where a non-tuple argument is its own single element. This way the result is
+    // constructed in one go and the instantiation depth is constant regardless of the number of elements.
+    template<size_t N> struct gather_plan {
+        array<size_t, N> arg{};
+        array<size_t, N> element{};
+    };
+
+    template<typename T> constexpr size_t gather_count()
+    {
+        if constexpr (is_tuple_like_v<decay_t<T>>)
+            return tuple_size_v<decay_t<T>>;
+        else
+            return 1;
+    }
+
+    // Elements of tuple-likes keep their declared type. Note: Don't convert back to rvalue-reference for non-tuples, non-tuple
+    // rvalues result in by value elements in the returned tuple.
+    template<bool IS_TUPLE, size_t EIX, typename T> struct gathered_type {
+        using type = T;
+    };
+    template<size_t EIX, typename T> struct gathered_type<true, EIX, T> {
+        using type = tuple_element_t<EIX, decay_t<T>>;
+    };
+
+    template<size_t AIX, size_t EIX, typename... Ts> using gathered_type_t = typename gathered_type<is_tuple_like_v<decay_t<type_pack_element_t<AIX, Ts...>>>, EIX, type_pack_element_t<AIX, Ts...>>::type;
+
+    template<size_t AIX, size_t EIX, typename... Ts> constexpr decltype(auto) gathered_element(tuple<Ts&&...>& args)
+    {
+        using T = type_pack_element_t<AIX, Ts...>;
+        if constexpr (is_tuple_like_v<decay_t<T>>)
+            return get<EIX>(forward<T>(get<AIX>(args)));
+        else
+            return forward<T>(get<AIX>(args));
+    }
+
+    // PLAN is a class with a static constexpr gather_plan value.
+    template<template<typename...> class RESULT, typename PLAN, size_t... IXs, typename... Ts> constexpr auto tuple_gather_helper(index_sequence<IXs...>, Ts&&... ts)
+    {
+        tuple<Ts&&...> args(forward<Ts>(ts)...);
+        return RESULT<gathered_type_t<PLAN::value.arg[IXs], PLAN::value.element[IXs], Ts...>...>{ gathered_element<PLAN::value.arg[IXs], PLAN::value.element[IXs], Ts...>(args)... };
+    }
+
+    template<template<typename...> class RESULT, typename PLAN, typename... Ts> constexpr auto tuple_gather(Ts&&... ts)
+    {
+        return tuple_gather_helper<RESULT, PLAN>(make_index_sequence<PLAN::value.arg.size()>(), forward<Ts>(ts)...);
+    }
+
+
+    // The arrange predicate is evaluated for all elements in one pack expansion, then the chain of next indices is followed in
+    // a constexpr loop.
+    struct arrange_step {
+        bool value;
+        size_t next;
+    };
+
+    template<template<size_t IX, size_t SIZE, typename E> class PRED, typename TLC, size_t... IXs> constexpr array<arrange_step, sizeof...(IXs)> arrange_steps(index_sequence<IXs...>)
+    {
+        return { arrange_step{ PRED<IXs, sizeof...(IXs), decay_t<tuple_element_t<IXs, TLC>>>::value, PRED<IXs, sizeof...(IXs), decay_t<tuple_element_t<IXs, TLC>>>::next }... };
+    }
+
+    template<size_t N> constexpr size_t arrange_count(const array<arrange_step, N>& steps, size_t pos)
+    {
+        size_t ret = 0;
+        for (; pos < N; pos = steps[pos].next)  // Note: This includes after decrement to -1 thanks to size_t being unsigned.
+            if (steps[pos].value)
+                ret++;
+
+        return ret;
+    }
+
+    template<size_t COUNT, size_t N> constexpr gather_plan<COUNT> arrange_gather_plan(const array<arrange_step, N>& steps, size_t pos)
+    {
+        gather_plan<COUNT> ret;
+        size_t ix = 0;
+        for (; pos < N; pos = steps[pos].next) {
+            if (steps[pos].value)
+                ret.element[ix++] = pos;
+        }
+
+        return ret;
+    }
+
+    template<template<size_t IX, size_t SIZE, typename E> class PRED, size_t POS, typename TLC> struct arrange_plan {
+        static constexpr auto steps = arrange_steps<PRED, TLC>(make_index_sequence<tuple_size_v<TLC>>());
+        static constexpr auto value = arrange_gather_plan<arrange_count(steps, POS)>(steps, POS);
+    };
+}
+
 // tuple_arrange returns a new tuple rearranged according to an arrange predicate. The predicate is a class template which takes
 // the current index and element type and the tuple size as template parameters and has a bool value which is the regular
 // include/exclude and next which is a size_t denoting the next index to test, or npos if the processing is finished. With such
@@ -240,41 +491,21 @@ template<template<typename> class PRED, typename D, typename TL> decltype(auto)
 
 // The returned object is of the same *tuple_category* as the parameter.
 
-template<template<size_t IX, size_t SIZE, typename E> class PRED, size_t POS = 0, template<typename...> class RESULT, typename TL, typename... Vs>
-auto tuple_arrange(TL&& t, Vs&&... vs)
+template<template<size_t IX, size_t SIZE, typename E> class PRED, size_t POS = 0, template<typename...> class RESULT, typename TL>
+constexpr auto tuple_arrange(TL&& t)
 {
-    using TLC = decay_t<TL>;
-    constexpr size_t SIZE = tuple_size_v<TLC>;
-
-    if constexpr (POS >= SIZE)
-        return RESULT<Vs...>{forward<Vs>(vs)...};
-    else {
-        using P = PRED<POS, SIZE, decay_t<tuple_element_t<POS, TLC>>>;
-
-        if constexpr (P::next >= SIZE) { // Note: This includes after decrement to -1 thanks to size_t being unsigned.
-            if constexpr (P::value)
-                return RESULT<Vs..., tuple_element_t<POS, TLC>>{forward<Vs>(vs)..., forward< tuple_element_t<POS, TLC>>(get<POS>(t))};
-            else
-                return RESULT<Vs...>{forward<Vs>(vs)...};
-        }
-        else {
-            if constexpr (P::value)
-                return tuple_arrange<PRED, P::next, RESULT>(forward<TL>(t), forward<Vs>(vs)..., get<POS>(t));
-            else
-                return tuple_arrange<PRED, P::next, RESULT>(forward<TL>(t), forward<Vs>(vs)...);
-        }
-    }
+    return detail::tuple_gather<RESULT, detail::arrange_plan<PRED, POS, decay_t<TL>>>(forward<TL>(t));
 }
 // Unfortunately the defaulted RESULT version must be implemented as a forwareding function as the type of the tuple is needed and
 // we don't want to explicitly have to name the type of our tuple when calling _with_ a RESULT template.
 template<template<size_t IX, size_t SIZE, typename E> class PRED, size_t POS = 0, typename TL>
-auto tuple_arrange(TL&& t)
+constexpr auto tuple_arrange(TL&& t)
 {
-    return tuple_arrange<PRED, POS, tuple_traits<TL>::template factory>(forward<TL>(t));
+    return tuple_arrange<PRED, POS, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
 }
 // To avoid having to give POS as 0 just to be able to give a RESULT we need another overload
 template<template<size_t IX, size_t SIZE, typename E> class PRED, template<typename...> class RESULT, typename TL>
-    auto tuple_arrange(TL&& t)
+    constexpr auto tuple_arrange(TL&& t)
 {
     return tuple_arrange<PRED, 0, RESULT>(forward<TL>(t));
 }
@@ -306,119 +537,337 @@ template<size_t IX, size_t SIZE, typename E> struct reverse_arranger {
 };
 
 
+namespace detail {
+    // std::arrays of the same element type are sliced, reversed, erased from and concatenated by copying ranges of elements with
+    // std::copy, which is a memmove for trivially copyable elements, instead of one pack expansion over all the elements. The
+    // same few functions are instantiated regardless of the size, so arrays of thousands of elements are fine. Arrays which are
+    // rvalues are moved from.
+    template<typename T> struct is_std_array : public false_type {};
+    template<typename E, size_t N> struct is_std_array<array<E, N>> : public true_type {};
+
+    template<typename... TLs> constexpr bool copies_as_arrays()
+    {
+        if constexpr (sizeof...(TLs) == 0 || !(is_std_array<decay_t<TLs>>::value && ...))
+            return false;
+        else {
+            using E = typename decay_t<type_pack_element_t<0, TLs...>>::value_type;
+            return is_default_constructible_v<E> && ((is_same_v<typename decay_t<TLs>::value_type, E> && (is_lvalue_reference_v<TLs> ? is_copy_assignable_v<E> : is_move_assignable_v<E>)) && ...);
+        }
+    }
+
+    template<bool MOVE, typename IT, typename OUT> constexpr OUT copy_elements(IT first, IT last, OUT out)
+    {
+        if constexpr (MOVE)
+            return std::move(first, last, out);
+        else
+            return std::copy(first, last, out);
+    }
+
+    template<typename... TLs> constexpr auto concat_arrays(TLs&&... tls)
+    {
+        array<typename decay_t<type_pack_element_t<0, TLs...>>::value_type, (tuple_size_v<decay_t<TLs>> + ...)> ret;
+        auto out = ret.begin();
+        ((out = copy_elements<!is_lvalue_reference_v<TLs>>(tls.begin(), tls.end(), out)), ...);
+        return ret;
+    }
+
+    template<size_t FROM, size_t TO, typename TL> constexpr auto slice_array(TL&& t)
+    {
+        constexpr size_t END = TO < tuple_size_v<decay_t<TL>> ? TO : tuple_size_v<decay_t<TL>>;
+        array<typename decay_t<TL>::value_type, END - FROM> ret;
+        copy_elements<!is_lvalue_reference_v<TL>>(t.begin() + FROM, t.begin() + END, ret.begin());
+        return ret;
+    }
+
+    template<size_t FROM, size_t TO, typename TL> constexpr auto erase_array(TL&& t)
+    {
+        constexpr size_t SIZE = tuple_size_v<decay_t<TL>>;
+        constexpr size_t END = TO < SIZE ? TO : SIZE;
+        constexpr size_t BEGIN = FROM < END ? FROM : END;
+        array<typename decay_t<TL>::value_type, SIZE - (END - BEGIN)> ret;
+        auto out = copy_elements<!is_lvalue_reference_v<TL>>(t.begin(), t.begin() + BEGIN, ret.begin());
+        copy_elements<!is_lvalue_reference_v<TL>>(t.begin() + END, t.end(), out);
+        return ret;
+    }
+
+    template<typename TL> constexpr auto reverse_array(TL&& t)
+    {
+        array<typename decay_t<TL>::value_type, tuple_size_v<decay_t<TL>>> ret;
+        copy_elements<!is_lvalue_reference_v<TL>>(t.rbegin(), t.rend(), ret.begin());
+        return ret;
+    }
+}
+
 // Return a tuple like consisting of a subset of the incoming tuple's elements. TO can be out of range, but FROM can't.
-template<size_t FROM, size_t TO, template<typename...> class RESULT, typename TL> auto tuple_slice(TL&& t)
+template<size_t FROM, size_t TO, template<typename...> class RESULT, typename TL> constexpr auto tuple_slice(TL&& t)
 {
     return tuple_arrange<slice_arranger<FROM, TO>::template tpl, RESULT>(t);
 }
-template<size_t FROM, size_t TO, typename TL> auto tuple_slice(TL&& t)
+template<size_t FROM, size_t TO, typename TL> constexpr auto tuple_slice(TL&& t)
 {
-    return tuple_slice<FROM, TO, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
+    if constexpr (detail::copies_as_arrays<TL>())
+        return detail::slice_array<FROM, TO>(forward<TL>(t));
+    else
+        return tuple_slice<FROM, TO, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
 }
 
 // Return a tuple like filtered by a predicate.
-template<template<typename T> class PRED, template<typename...> class RESULT, typename TL> auto tuple_filter(TL&& t)
+template<template<typename T> class PRED, template<typename...> class RESULT, typename TL> constexpr auto tuple_filter(TL&& t)
 {
     return tuple_arrange<filter_arranger<PRED>::template tpl, RESULT>(t);
 }
-template<template<typename T> class PRED, typename TL> auto tuple_filter(TL&& t)
+template<template<typename T> class PRED, typename TL> constexpr auto tuple_filter(TL&& t)
 {
     return tuple_filter<PRED, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
 }
 
 // Return a tuple with elements in reverse order.
-template<template<typename...> class RESULT, typename TL> auto tuple_reverse(TL&& t)
+template<template<typename...> class RESULT, typename TL> constexpr auto tuple_reverse(TL&& t)
 {
     return tuple_arrange<reverse_arranger, tuple_size_v<decay_t<TL>> - 1, RESULT>(t);
 }
-template<typename TL> auto tuple_reverse(TL&& t)
+template<typename TL> constexpr auto tuple_reverse(TL&& t)
 {
-    return tuple_reverse<tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
+    if constexpr (detail::copies_as_arrays<TL>())
+        return detail::reverse_array(forward<TL>(t));
+    else
+        return tuple_reverse<tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
 }
 
 
 namespace detail {
-    template<typename F, typename S> struct typelist_append;
-    template<typename... Ts, typename T> struct typelist_append<type_list<Ts...>, T> {
-        using type = type_list<Ts..., T>;
-    };
-    template<typename F, typename S> using typelist_append_t = typename typelist_append<F, S>::type;
-
-    template<template<typename...> class RESULT, typename... Ts, typename... Vs> auto result_from_typelist(type_list<Ts...>, Vs&&... vs)
+    template<typename... TLs> constexpr auto make_concat_plan()
     {
-        return RESULT<Ts...>{forward<Vs>(vs)...};
+        constexpr size_t counts[] = { gather_count<TLs>()..., 0 };
+        gather_plan<(gather_count<TLs>() + ... + 0)> ret;
+        size_t ix = 0;
+        for (size_t a = 0; a < sizeof...(TLs); a++) {
+            for (size_t e = 0; e < counts[a]; e++) {
+                ret.arg[ix] = a;
+                ret.element[ix++] = e;
+            }
+        }
+
+        return ret;
     }
 
-    // This sentinel is used only when there are one or more empty tuples being concatenated.
-    template<template<typename...> class RESULT, size_t NTIX, size_t EIX, typename RT> auto tuple_concat_helper()
+    template<typename... TLs> struct concat_plan {
+        static constexpr auto value = make_concat_plan<TLs...>();
+    };
+
+    // The elements of t before POS, then el (flattened if it is a tuple-like) and then the rest of t.
+    template<size_t POS, typename TL, typename EL> constexpr auto make_insert_plan()
     {
-        static_assert(tuple_size_v<RT> == 0);
-        return RESULT<>();
+        constexpr size_t SIZE = gather_count<TL>();
+        constexpr size_t COUNT = gather_count<EL>();
+        constexpr size_t AT = POS < SIZE ? POS : SIZE;
+        auto ret = make_concat_plan<TL, EL>();
+        for (size_t ix = 0; ix < COUNT; ix++) {
+            ret.arg[AT + ix] = 1;
+            ret.element[AT + ix] = ix;
+        }
+        for (size_t ix = AT; ix < SIZE; ix++) {
+            ret.arg[ix + COUNT] = 0;
+            ret.element[ix + COUNT] = ix;
+        }
+
+        return ret;
     }
 
+    template<size_t POS, typename TL, typename EL> struct insert_plan {
+        static constexpr auto value = make_insert_plan<POS, TL, EL>();
+    };
 
-    // TLVs is a combination of remaining tuples followed by flattened elements accrued so far. The first NTIX elements are incoming tuples (or non-tuples).
-    template<template<typename...> class RESULT, size_t NTIX, size_t EIX, typename RT, typename TL, typename... TLVs> auto tuple_concat_helper(TL&& first, TLVs&&... rest)
+    // The elements of t except those in [FROM, TO).
+    template<size_t FROM, size_t TO, typename TL> constexpr auto make_erase_plan()
     {
-        if constexpr (NTIX == 0)
-            return result_from_typelist<RESULT>(RT(), forward<TL>(first), forward<TLVs>(rest)...);
-        else if constexpr (is_tuple_like_v<decay_t<TL>>) {
-            if constexpr (EIX == tuple_size_v<decay_t<TL>>)        // Currently processed TL tuple has ended. All its elements already in rest, so just drop TL.
-                return tuple_concat_helper<RESULT, NTIX - 1, 0, RT>(forward<TLVs>(rest)...);
-            else
-                return tuple_concat_helper<RESULT, NTIX, EIX + 1, typelist_append_t<RT, tuple_element_t<EIX, decay_t<TL>>>>(forward<TL>(first), forward<TLVs>(rest)..., get<EIX>(forward<TL>(first)));
+        constexpr size_t SIZE = tuple_size_v<TL>;
+        constexpr size_t END = TO < SIZE ? TO : SIZE;
+        constexpr size_t BEGIN = FROM < END ? FROM : END;
+
+        gather_plan<SIZE - (END - BEGIN)> ret;
+        size_t ix = 0;
+        for (size_t e = 0; e < SIZE; e++) {
+            if (e < BEGIN || e >= END)
+                ret.element[ix++] = e;
         }
-        else
-            // Note: Don't convert back to rvalue-reference in the type list, non-tuple rvalues sent into tuple_concat will result
-            // in by value elements in the returned tuple.
-            return tuple_concat_helper<RESULT, NTIX - 1, 0, typelist_append_t<RT, TL>>(forward<TLVs>(rest)..., forward<TL>(first));
+
+        return ret;
     }
+
+    template<size_t FROM, size_t TO, typename TL> struct erase_plan {
+        static constexpr auto value = make_erase_plan<FROM, TO, TL>();
+    };
 }
 
 // tuple_concat concatenates all tuple likes to a long RESULT. If there are non-tuple-likes in tls they are just inserted. This way
 // prepend, append and flatten are implemented in the same function. It does hurt error checking though, which may be a reason to
 // reinstate the different names.
-template<template<typename...> class RESULT, typename... TLs> auto tuple_concat(TLs&&... tls)
+template<template<typename...> class RESULT, typename... TLs> constexpr auto tuple_concat(TLs&&... tls)
 {
-        return detail::tuple_concat_helper<RESULT, sizeof...(TLs), 0, type_list<>>(forward<TLs>(tls)...);
+        return detail::tuple_gather<RESULT, detail::concat_plan<TLs...>>(forward<TLs>(tls)...);
 }
-template<typename... TLs> auto tuple_concat(TLs&&... tls)
+template<typename... TLs> constexpr auto tuple_concat(TLs&&... tls)
 {
+    if constexpr (detail::copies_as_arrays<TLs...>())
+        return detail::concat_arrays(forward<TLs>(tls)...);
+    else
         return tuple_concat<common_tuple_traits<decay_t<TLs>...>::factory::template type>(forward<TLs>(tls)...);
 }
 
 // tuple_insert allows inserting an element or a tuple-like into another tuple-like at a certain position. If the inserted thing is
 // a tuple it will be flattened, which is most likely the intent. If not you can quote the tuple inside another 1 element tuple when
 // calling this function.
-template<size_t POS, template<typename...> class RESULT, typename TL, typename EL> auto tuple_insert(TL&& t, EL&& el)
+template<size_t POS, template<typename...> class RESULT, typename TL, typename EL> constexpr auto tuple_insert(TL&& t, EL&& el)
 {
-    return tuple_concat<RESULT>(tuple_slice<0, POS>(forward<TL>(t)), forward<EL>(el), tuple_slice<POS, npos>(forward<TL>(t)));
+    return detail::tuple_gather<RESULT, detail::insert_plan<POS, TL, EL>>(forward<TL>(t), forward<EL>(el));
 }
-template<size_t POS, typename TL, typename EL> auto tuple_insert(TL&& t, EL&& el)
+template<size_t POS, typename TL, typename EL> constexpr auto tuple_insert(TL&& t, EL&& el)
 {
     return tuple_insert<POS, common_tuple_traits<decay_t<TL>, decay_t<EL>>::factory::template type, TL, EL>(forward<TL>(t), forward<EL>(el));
 }
 
 // tuple_erase allows erasing some elements in the middle of a tuple.
-template<size_t FROM, size_t TO, template<typename...> class RESULT, typename TL> auto tuple_erase(TL&& t)
+template<size_t FROM, size_t TO, template<typename...> class RESULT, typename TL> constexpr auto tuple_erase(TL&& t)
 {
-    return tuple_concat<RESULT>(tuple_slice<0, FROM>(forward<TL>(t)), tuple_slice<TO, npos>(forward<TL>(t)));
+    return detail::tuple_gather<RESULT, detail::erase_plan<FROM, TO, decay_t<TL>>>(forward<TL>(t));
 }
-template<size_t FROM, size_t TO, typename TL> auto tuple_erase(TL&& t)
+template<size_t FROM, size_t TO, typename TL> constexpr auto tuple_erase(TL&& t)
 {
-    return tuple_erase<FROM, TO, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
+    if constexpr (detail::copies_as_arrays<TL>())
+        return detail::erase_array<FROM, TO>(forward<TL>(t));
+    else
+        return tuple_erase<FROM, TO, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
 }
 
 // Overload to erase one element.
-template<size_t IX, template<typename...> class RESULT, typename TL> auto tuple_erase(TL&& t)
+template<size_t IX, template<typename...> class RESULT, typename TL> constexpr auto tuple_erase(TL&& t)
 {
     return tuple_erase<IX, IX + 1, RESULT>(forward<TL>(t));
 }
-template<size_t IX, typename TL> auto tuple_erase(TL&& t)
+template<size_t IX, typename TL> constexpr auto tuple_erase(TL&& t)
 {
-    return tuple_erase<IX, tuple_traits<decay_t<TL>>::factory::template type>(forward<TL>(t));
+    return tuple_erase<IX, IX + 1>(forward<TL>(t));
+}
+
+
+//////////////// Tuple storing its elements ordered by alignment ////////////////
+
+namespace detail {
+    template<typename T> constexpr size_t storage_alignment()
+    {
+        if constexpr (is_reference_v<T>)
+            return alignof(void*);
+        else
+            return alignof(T);
+    }
+
+    // The storage index of each element: The storage tuple holds the elements by decreasing alignment, elements with the same
+    // alignment in declaration order. As alignments are powers of two the padding of a struct of the elements in this order is
+    // at most what is needed to round the total size up to the largest alignment. The storage tuple may lay its elements out in
+    // another order, as libstdc++ does in reverse, but the total size stays the same.
+    template<typename... Ts> constexpr array<size_t, sizeof...(Ts)> make_packed_positions()
+    {
+        constexpr size_t alignments[] = { storage_alignment<Ts>()..., 0 };
+        array<size_t, sizeof...(Ts)> ret{};
+        for (size_t ix = 0; ix < sizeof...(Ts); ix++) {
+            for (size_t other = 0; other < sizeof...(Ts); other++) {
+                if (alignments[other] > alignments[ix] || (alignments[other] == alignments[ix] && other < ix))
+                    ret[ix]++;
+            }
+        }
+
+        return ret;
+    }
+
+    // The declared index of each stored element.
+    template<typename... Ts> constexpr array<size_t, sizeof...(Ts)> make_packed_order()
+    {
+        constexpr auto positions = make_packed_positions<Ts...>();
+        array<size_t, sizeof...(Ts)> ret{};
+        for (size_t ix = 0; ix < sizeof...(Ts); ix++)
+            ret[positions[ix]] = ix;
+
+        return ret;
+    }
+
+    template<typename... Ts> struct packed_layout {
+        static constexpr auto positions = make_packed_positions<Ts...>();
+        static constexpr auto order = make_packed_order<Ts...>();
+    };
+
+    template<typename... Ts, size_t... SIXs> auto packed_storage(index_sequence<SIXs...>) -> tuple<type_pack_element_t<packed_layout<Ts...>::order[SIXs], Ts...>...>;
 }
 
+template<typename... Ts> class packed_tuple;
+
+template<size_t IX, typename... Ts> constexpr type_pack_element_t<IX, Ts...>& get(packed_tuple<Ts...>& t) noexcept;
+template<size_t IX, typename... Ts> constexpr const type_pack_element_t<IX, Ts...>& get(const packed_tuple<Ts...>& t) noexcept;
+template<size_t IX, typename... Ts> constexpr type_pack_element_t<IX, Ts...>&& get(packed_tuple<Ts...>&& t) noexcept;
+template<size_t IX, typename... Ts> constexpr const type_pack_element_t<IX, Ts...>&& get(const packed_tuple<Ts...>&& t) noexcept;
+
+// packed_tuple is a tuple-like which stores its elements grouped by alignment, which gives it the minimal total size for its
+// element types. It is smaller than a tuple of the same types when alignments are mixed. The order of the elements in memory,
+// the padding between them and the order in which they are constructed are unspecified. Indexing, and thereby iteration and
+// lookup by name, is in declaration order.
+template<typename... Ts> class packed_tuple {
+    using layout = detail::packed_layout<Ts...>;
+    using storage = decltype(detail::packed_storage<Ts...>(index_sequence_for<Ts...>()));
+
+public:
+    constexpr packed_tuple() = default;
+
+    // Construct from one value per element, in declaration order.
+    template<typename... As> requires (sizeof...(As) == sizeof...(Ts) && sizeof...(Ts) > 0 && (!is_same_v<remove_cvref_t<As>, packed_tuple> && ...))
+    constexpr packed_tuple(As&&... as) : m_elements(make_storage(forward_as_tuple(forward<As>(as)...), index_sequence_for<Ts...>())) {}
+
+private:
+    template<typename A, size_t... SIXs> static constexpr storage make_storage(A&& args, index_sequence<SIXs...>) {
+        return storage(get<layout::order[SIXs]>(std::move(args))...);
+    }
+
+    template<size_t IX, typename... Us> friend constexpr type_pack_element_t<IX, Us...>& get(packed_tuple<Us...>& t) noexcept;
+    template<size_t IX, typename... Us> friend constexpr const type_pack_element_t<IX, Us...>& get(const packed_tuple<Us...>& t) noexcept;
+    template<size_t IX, typename... Us> friend constexpr type_pack_element_t<IX, Us...>&& get(packed_tuple<Us...>&& t) noexcept;
+    template<size_t IX, typename... Us> friend constexpr const type_pack_element_t<IX, Us...>&& get(const packed_tuple<Us...>&& t) noexcept;
+
+    storage m_elements;
+};
+
+template<typename... Ts> struct tuple_size<packed_tuple<Ts...>> {
+    static constexpr size_t value = sizeof...(Ts);
+};
+
+template<size_t IX, typename... Ts> struct tuple_element<IX, packed_tuple<Ts...>> {
+    using type = type_pack_element_t<IX, Ts...>;
+};
+
+template<size_t IX, typename... Ts> constexpr type_pack_element_t<IX, Ts...>& get(packed_tuple<Ts...>& t) noexcept
+{
+    return get<detail::packed_layout<Ts...>::positions[IX]>(t.m_elements);
+}
+template<size_t IX, typename... Ts> constexpr const type_pack_element_t<IX, Ts...>& get(const packed_tuple<Ts...>& t) noexcept
+{
+    return get<detail::packed_layout<Ts...>::positions[IX]>(t.m_elements);
+}
+template<size_t IX, typename... Ts> constexpr type_pack_element_t<IX, Ts...>&& get(packed_tuple<Ts...>&& t) noexcept
+{
+    return get<detail::packed_layout<Ts...>::positions[IX]>(std::move(t.m_elements));
+}
+template<size_t IX, typename... Ts> constexpr const type_pack_element_t<IX, Ts...>&& get(const packed_tuple<Ts...>&& t) noexcept
+{
+    return get<detail::packed_layout<Ts...>::positions[IX]>(std::move(t.m_elements));
+}
+
+struct packed_tuple_factory {
+    template<typename... Ts> using type = packed_tuple<Ts...>;
+};
+
+template<typename... Ts> struct tuple_traits<packed_tuple<Ts...>> {
+    constexpr static bool specialized = true;
+    using factory = packed_tuple_factory;
+};
+
 
 
 }   // namespace std